@@ -28,16 +28,17 @@ _TestAByteOfRam:
 	[--sp] = p3;
 	[--sp] = p2;
 	//
-	// Pointer to following structure is passed in r1.
+	// Pointer to following structure is passed in r0.
 	//
 	//   	typedef struct {
 	//		      UINT8  * pByteToTest;
 	//		      UINT8  * pPatternThatFailed;
-	//		const UINT8  * pTestPatterns;
+	//		const UINT32 * pTestPatterns;
 	//		      UINT32   NumberOfTestPatterns;
+	//		      UINT8  * pValueReadBack;
 	//	} ByteTestParameters;
 	//
-	p0 = r1;				// Pointer to struct in p0 for indirect addressing
+	p0 = r0;				// Pointer to struct in p0 for indirect addressing
 	p1 = [p0];              // p1 = pByteToTest
 	p2 = [p0+4];        	// p2 = pPatternThatFailed, returned to caller upon failure
 	p3 = [p0+8];			// p3 = pTestPatterns
@@ -60,7 +61,7 @@ Exit:
 	unlink;
 	rts;
 NextPattern:
-	r0 = B [p3];            // Next test pattern in r0
+	r0 = B [p3];            // Next test pattern in r0, the low byte of the 32 bit pattern
 	B [p1] = r0;
 	nop;
 	nop;
@@ -70,10 +71,12 @@ NextPattern:
 	cc = r0 == r4;          // Did it read back correctly ?
 	if cc jump PrepareForNextPattern;
 	B [p2] = r0;     		// Save test pattern that failed
+	p2 = [p0+16];			// p2 = pValueReadBack
+	B [p2] = r4;			// Save value read back
 	r0 = 0;                 // Indicate an error to the caller
 	jump.s	Exit;			// Finish up
 PrepareForNextPattern:
-	p3 += 1;				// Point to next pattern
+	p3 += 4;				// Point to next pattern
 	r3 += 1;				// Increment the number of patterns tested.
 	jump.s CheckForMoreTestPatterns;
 _TestAByteOfRam.end:
@@ -0,0 +1,212 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDataRamTestReference.cpp
+///
+/// C++ reference versions of the assembly language RAM test subroutines in BlackfinDataRamTestByte.s and
+/// BlackfinDataRamTestWords.s.  Only built with BLACKFIN_DIAG_HOST_BUILD defined, in place of the assembly language,
+/// so BlackfinDiagDataRam can be run on a Linux host against the RAM simulator.
+///
+/// Each subroutine does what its assembly language version does, word for word and pattern for pattern, and reports a
+/// failure through the same parameter structure members.  All memory being tested is read and written through the
+/// RAM simulator.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagDataRam.hpp"
+#include "BlackfinDiagRamSimulator.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 ALL_ONES_PATTERN     = 0xffffffff;
+    static const UINT32 CHECKERBOARD_PATTERN = 0x55555555;
+    static const UINT32 BITS_PER_WORD        = 32;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: TestAByteOfRam
+    ///
+    ///      Reference version of _TestAByteOfRam.  The byte is saved, the low byte of each pattern is written
+    ///      and read back, and the byte is restored.  The low byte of a pattern that fails is stored through
+    ///      m_pPatternThatFailed and the byte read back through m_pValueReadBack.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	extern "C" BOOL TestAByteOfRam( BlackfinDiagDataRam::ByteTestParameters * pbtp )
+	{
+	    UINT8 savedByte  = BlackfinDiagRamSimulator::ReadByte( pbtp->m_pByteToTest );
+
+	    BOOL  testPassed = TRUE;
+
+	    for ( UINT32 ui = 0; ui < pbtp->m_NmbrTestPatterns; ++ui )
+	    {
+	        UINT8 pattern = static_cast<UINT8>( pbtp->m_pTestPatterns[ ui ] );
+
+	        BlackfinDiagRamSimulator::WriteByte( pbtp->m_pByteToTest, pattern );
+
+	        UINT8 readBack = BlackfinDiagRamSimulator::ReadByte( pbtp->m_pByteToTest );
+
+	        if ( pattern != readBack )
+	        {
+	            *pbtp->m_pPatternThatFailed = pattern;
+
+	            *pbtp->m_pValueReadBack     = readBack;
+
+	            testPassed = FALSE;
+
+	            break;
+	        }
+	    }
+
+	    BlackfinDiagRamSimulator::WriteByte( pbtp->m_pByteToTest, savedByte );
+
+	    return testPassed;
+	}
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: TestWordsOfRam
+    ///
+    ///      Reference version of _TestWordsOfRam.  Each word is saved, every pattern of the table is written
+    ///      and read back, and the word is restored before moving on to the next word.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	extern "C" BOOL TestWordsOfRam( BlackfinDiagDataRam::WordsTestParameters * pwtp )
+	{
+	    if ( 0 == pwtp->m_NmbrTestPatterns )
+	    {
+	        return TRUE;
+	    }
+
+	    for ( UINT32 ui = 0; ui < pwtp->m_NmbrWordsToTest; ++ui )
+	    {
+	        UINT32 * pWord     = pwtp->m_pWordsToTest + ui;
+
+	        UINT32   savedWord = BlackfinDiagRamSimulator::ReadWord( pWord );
+
+	        for ( UINT32 pattern = 0; pattern < pwtp->m_NmbrTestPatterns; ++pattern )
+	        {
+	            BlackfinDiagRamSimulator::WriteWord( pWord, pwtp->m_pTestPatterns[ pattern ] );
+
+	            UINT32 readBack = BlackfinDiagRamSimulator::ReadWord( pWord );
+
+	            if ( pwtp->m_pTestPatterns[ pattern ] != readBack )
+	            {
+	                BlackfinDiagRamSimulator::WriteWord( pWord, savedWord );
+
+	                pwtp->m_pWordThatFailed   = pWord;
+
+	                pwtp->m_PatternThatFailed = pwtp->m_pTestPatterns[ pattern ];
+
+	                pwtp->m_ValueReadBack     = readBack;
+
+	                return FALSE;
+	            }
+	        }
+
+	        BlackfinDiagRamSimulator::WriteWord( pWord, savedWord );
+	    }
+
+	    return TRUE;
+	}
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: WriteAndReadBack
+    ///
+    ///      Writes a pattern to a word and reads it back, reporting the failure the way the assembly language
+    ///      does.  The word is restored when the pattern fails.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	static BOOL WriteAndReadBack( BlackfinDiagDataRam::WordsTestParameters * pwtp,
+	                              UINT32 *                                   pWord,
+	                              UINT32                                     savedWord,
+	                              UINT32                                     pattern )
+	{
+	    BlackfinDiagRamSimulator::WriteWord( pWord, pattern );
+
+	    UINT32 readBack = BlackfinDiagRamSimulator::ReadWord( pWord );
+
+	    if ( pattern == readBack )
+	    {
+	        return TRUE;
+	    }
+
+	    BlackfinDiagRamSimulator::WriteWord( pWord, savedWord );
+
+	    pwtp->m_pWordThatFailed   = pWord;
+
+	    pwtp->m_PatternThatFailed = pattern;
+
+	    pwtp->m_ValueReadBack     = readBack;
+
+	    return FALSE;
+	}
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: TestWordsOfRamGeneratedPatterns
+    ///
+    ///      Reference version of _TestWordsOfRamGeneratedPatterns.  Each word is saved, all ones, all zeros,
+    ///      both checkerboards and each walking one followed by its walking zero are written and read back, and
+    ///      the word is restored before moving on to the next word.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	extern "C" BOOL TestWordsOfRamGeneratedPatterns( BlackfinDiagDataRam::WordsTestParameters * pwtp )
+	{
+	    for ( UINT32 ui = 0; ui < pwtp->m_NmbrWordsToTest; ++ui )
+	    {
+	        UINT32 * pWord     = pwtp->m_pWordsToTest + ui;
+
+	        UINT32   savedWord = BlackfinDiagRamSimulator::ReadWord( pWord );
+
+	        if (    !WriteAndReadBack( pwtp, pWord, savedWord, ALL_ONES_PATTERN )
+	             || !WriteAndReadBack( pwtp, pWord, savedWord, ~ALL_ONES_PATTERN )
+	             || !WriteAndReadBack( pwtp, pWord, savedWord, CHECKERBOARD_PATTERN )
+	             || !WriteAndReadBack( pwtp, pWord, savedWord, ~CHECKERBOARD_PATTERN ) )
+	        {
+	            return FALSE;
+	        }
+
+	        for ( UINT32 walkingOne = 1, bit = 0; bit < BITS_PER_WORD; walkingOne <<= 1, ++bit )
+	        {
+	            if (    !WriteAndReadBack( pwtp, pWord, savedWord, walkingOne )
+	                 || !WriteAndReadBack( pwtp, pWord, savedWord, ~walkingOne ) )
+	            {
+	                return FALSE;
+	            }
+	        }
+
+	        BlackfinDiagRamSimulator::WriteWord( pWord, savedWord );
+	    }
+
+	    return TRUE;
+	}
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: FlushAndInvalidateDataCacheLines
+    ///
+    ///      Reference version of _FlushAndInvalidateDataCacheLines.  The simulated RAM has no cache in front of 
+    ///      it so there is nothing to do.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	extern "C" void FlushAndInvalidateDataCacheLines( UINT8 * /* pFirstByte */, UINT32 /* nmbrBytes */ )
+	{
+	}
+
+}
+
+#endif // defined(BLACKFIN_DIAG_HOST_BUILD)
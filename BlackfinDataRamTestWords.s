@@ -0,0 +1,208 @@
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDataRamTestWords.s
+///
+/// Blackfin assembly language subroutines to test a block of 32 bit words of RAM. Called from BlackfinDataRam.cpp
+///
+/// Each word is saved in a register, every test pattern is written to the word and read back, and the word is
+/// restored before moving on to the next word.  Patterns are 32 bits wide so all four byte lanes are tested with
+/// each write.  Zero overhead hardware loops are used for both the words and the patterns.  Nothing but the words
+/// being tested is written to while testing so the block may contain the caller's stack.
+///
+/// _TestWordsOfRam reads the patterns from the caller's table.  _TestWordsOfRamGeneratedPatterns builds the 
+/// standard pattern family in registers instead, all ones, all zeros, both checkerboards, walking ones and walking 
+/// zeros, so no memory is read but the word being tested.
+///
+/// _FlushAndInvalidateDataCacheLines writes back and invalidates the data cache lines holding a range of bytes, so
+/// the next reads of the range come from the physical memory.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include <asm_sprt.h>                              /* Added for ssync( ), cli/sti( ) */
+
+	.section/DOUBLEANY program;
+	.align 4;
+
+_TestWordsOfRam:
+	link 0;
+	//
+	// Since we're testing RAM we want to work with registers only.
+	//
+	[--sp] = (r7:7, p5:3);	// Save non scratchpad registers
+	//
+	// Pointer to following structure is passed in r0.
+	//
+	//   	typedef struct {
+	//		      UINT32 * pWordsToTest;
+	//		      UINT32   NumberOfWordsToTest;
+	//		const UINT32 * pTestPatterns;
+	//		      UINT32   NumberOfTestPatterns;
+	//		      UINT32 * pWordThatFailed;
+	//		      UINT32   PatternThatFailed;
+	//		      UINT32   ValueReadBack;
+	//	} WordsTestParameters;
+	//
+	p0 = r0;				// Pointer to struct in p0 for indirect addressing
+	r7 = r0;				// Keep the struct pointer for reporting a failure
+	p1 = [p0];              // p1 = pWordsToTest
+	p4 = [p0+4];        	// p4 = NumberOfWordsToTest
+	p2 = [p0+8];			// p2 = pTestPatterns
+	p5 = [p0+12];			// p5 = NumberOfTestPatterns
+
+	r0 = 1; 				// Nothing to test is a pass
+	cc = p4 == 0;
+	if cc jump Exit;
+	cc = p5 == 0;
+	if cc jump Exit;
+
+	lsetup( WordLoopStart, WordLoopEnd ) lc1 = p4;
+WordLoopStart:
+	r1 = [p1];				// Save actual memory contents in r1
+	p3 = p2;				// First test pattern
+
+	lsetup( PatternLoopStart, PatternLoopEnd ) lc0 = p5;
+PatternLoopStart:
+	r2 = [p3++];            // Next test pattern in r2
+	[p1] = r2;				// Save test pattern in memory location being tested.
+	r3 = [p1];              // Read it back
+	cc = r2 == r3;          // Did it read back correctly ?
+	if !cc jump WordFailed;
+PatternLoopEnd:
+	nop;					// A hardware loop can not end on a jump
+
+WordLoopEnd:
+	[p1++] = r1;			// Restore orignal memory contents and point to the next word
+
+	r0 = 1; 				// Finished with all the words, no errors found, return TRUE
+Exit:
+	(r7:7, p5:3) = [sp++];	// Restore non scratchpad registers
+	unlink;
+	rts;
+WordFailed:
+	[p1] = r1;				// Restore orignal memory contents
+	r0 = 0;                 // Indicate an error to the caller
+	lc0 = r0;				// Left the hardware loops early, stop them
+	lc1 = r0;
+	p0 = r7;
+	[p0+16] = p1;			// Save address of the word that failed
+	[p0+20] = r2;			// Save test pattern that failed
+	[p0+24] = r3;			// Save value read back
+	jump.s	Exit;			// Finish up
+_TestWordsOfRam.end:
+.GLOBAL _TestWordsOfRam;
+
+_TestWordsOfRamGeneratedPatterns:
+	link 0;
+	//
+	// Since we're testing RAM we want to work with registers only.
+	//
+	[--sp] = (r7:4, p5:3);	// Save non scratchpad registers
+	//
+	// Pointer to the WordsTestParameters structure is passed in r0, the test pattern members are not used.
+	//
+	p0 = r0;				// Pointer to struct in p0 for indirect addressing
+	r7 = r0;				// Keep the struct pointer for reporting a failure
+	p1 = [p0];              // p1 = pWordsToTest
+	p4 = [p0+4];        	// p4 = NumberOfWordsToTest
+	p5 = 32;				// Bits walked across each word
+
+	r0 = 1; 				// Nothing to test is a pass
+	cc = p4 == 0;
+	if cc jump GeneratedExit;
+
+	lsetup( GeneratedWordLoopStart, GeneratedWordLoopEnd ) lc1 = p4;
+GeneratedWordLoopStart:
+	r1 = [p1];				// Save actual memory contents in r1
+
+	r2 = -1;				// All ones
+	[p1] = r2;
+	r3 = [p1];
+	cc = r2 == r3;
+	if !cc jump GeneratedWordFailed;
+	r4 = ~r2;				// All zeros
+	[p1] = r4;
+	r3 = [p1];
+	cc = r4 == r3;
+	if !cc jump GeneratedComplementFailed;
+
+	r2.l = 0x5555;			// Checkerboard
+	r2.h = 0x5555;
+	[p1] = r2;
+	r3 = [p1];
+	cc = r2 == r3;
+	if !cc jump GeneratedWordFailed;
+	r4 = ~r2;				// Inverse checkerboard
+	[p1] = r4;
+	r3 = [p1];
+	cc = r4 == r3;
+	if !cc jump GeneratedComplementFailed;
+
+	r2 = 1;					// Walking one, its complement is the walking zero
+	lsetup( WalkLoopStart, WalkLoopEnd ) lc0 = p5;
+WalkLoopStart:
+	[p1] = r2;
+	r3 = [p1];
+	cc = r2 == r3;
+	if !cc jump GeneratedWordFailed;
+	r4 = ~r2;
+	[p1] = r4;
+	r3 = [p1];
+	cc = r4 == r3;
+	if !cc jump GeneratedComplementFailed;
+WalkLoopEnd:
+	r2 <<= 1;				// Walk the bit to the next position
+
+GeneratedWordLoopEnd:
+	[p1++] = r1;			// Restore orignal memory contents and point to the next word
+
+	r0 = 1; 				// Finished with all the words, no errors found, return TRUE
+GeneratedExit:
+	(r7:4, p5:3) = [sp++];	// Restore non scratchpad registers
+	unlink;
+	rts;
+GeneratedComplementFailed:
+	r2 = r4;				// The complement is the pattern that failed
+GeneratedWordFailed:
+	[p1] = r1;				// Restore orignal memory contents
+	r0 = 0;                 // Indicate an error to the caller
+	lc0 = r0;				// Left the hardware loops early, stop them
+	lc1 = r0;
+	p0 = r7;
+	[p0+16] = p1;			// Save address of the word that failed
+	[p0+20] = r2;			// Save test pattern that failed
+	[p0+24] = r3;			// Save value read back
+	jump.s	GeneratedExit;	// Finish up
+_TestWordsOfRamGeneratedPatterns.end:
+.GLOBAL _TestWordsOfRamGeneratedPatterns;
+
+_FlushAndInvalidateDataCacheLines:
+	link 0;
+	//
+	// First byte of the range is passed in r0, the number of bytes in r1.
+	//
+	p0 = r0;				// First byte, the line holding it is the first line
+	r2 = 31;				// Cache lines are 32 bytes
+	r3 = r0 & r2;			// Bytes of the first line before the range
+	r1 = r1 + r3;
+	r1 = r1 + r2;
+	r1 >>= 5;				// Number of lines holding the range
+	cc = r1 == 0;
+	if cc jump FlushExit;
+	p1 = r1;
+
+	lsetup( FlushLoop, FlushLoop ) lc0 = p1;
+FlushLoop:
+	flushinv [p0++];		// Write back the line if dirty, invalidate it and point to the next line
+
+	ssync;					// Wait for the write backs to complete
+FlushExit:
+	unlink;
+	rts;
+_FlushAndInvalidateDataCacheLines.end:
+.GLOBAL _FlushAndInvalidateDataCacheLines;
@@ -0,0 +1,48 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagAddress.hpp
+///
+/// Namespace for the integer type addresses are converted to for arithmetic on them
+///
+/// @par Full Description
+///
+/// Blackfin addresses are 32 bits, so the tests convert pointers to UINT32 to align them and to compare ranges.  The
+/// Linux host build, BLACKFIN_DIAG_HOST_BUILD defined, runs on 64 bit hosts where a pointer does not fit in a UINT32,
+/// so there addresses are converted to uintptr_t instead.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_ADDRESS_HPP)
+#define BLACKFIN_DIAG_ADDRESS_HPP
+
+// SYSTEM INCLUDES
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+#include <stdint.h>
+#endif
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+// (none)
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+    typedef uintptr_t AddressValue;
+#else
+    typedef UINT32    AddressValue;
+#endif
+};
+
+#endif //!defined(BLACKFIN_DIAG_ADDRESS_HPP)
@@ -21,9 +21,11 @@
 #include "Defs.h"
 #include "Os_iotk.h"             // This file depends on Defs.h.  It should include that file
 #include "Hw.h"                  // Ditto 
+#include "Nvs_Obj.h"
 
 
 // C++ PROJECT INCLUDES
+#include "BlackfinDiagAddress.hpp"
 #include "BlackfinDiagDataRam.hpp"
 
 
@@ -35,6 +37,68 @@ namespace BlackfinDiagnosticTesting
 	// Linkage to the assembly language subrouting for testing a byte of RAM.
 	extern "C" BOOL TestAByteOfRam( BlackfinDiagDataRam::ByteTestParameters * pbtp );
 
+	// Linkage to the assembly language subrouting for testing a block of words of RAM.
+	extern "C" BOOL TestWordsOfRam( BlackfinDiagDataRam::WordsTestParameters * pwtp );
+
+	// Linkage to the assembly language subrouting for testing a block of words of RAM with patterns built in registers.
+	extern "C" BOOL TestWordsOfRamGeneratedPatterns( BlackfinDiagDataRam::WordsTestParameters * pwtp );
+
+	// Linkage to the assembly language subrouting for flushing and invalidating a range from the data cache.
+	extern "C" void FlushAndInvalidateDataCacheLines( UINT8 * pFirstByte, UINT32 nmbrBytes );
+
+	// User data _OS_Assert copies into the crash header, defined in Os_iotk.c.
+	extern "C" USER_CRASH_DATA user_crash_data;
+
+	//
+	// The last failures found by any of the data RAM tests.  Like the OS data it is not initialized at start up, so 
+	// after a reset that did not remove power the records of the failure that caused it can still be read.
+	//
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+#pragma section("L1_scratchpad", NO_INIT)
+#endif
+	static BlackfinDiagDataRam::DataRamFaultRing s_FaultRing;
+
+    const BlackfinDiagDataRam::MarchElement BlackfinDiagDataRam::MARCH_ELEMENTS[] = 
+                                           {
+                                               // March C-
+                                               { FALSE, 1, { MARCH_WRITE_0 } },
+                                               { FALSE, 2, { MARCH_READ_0, MARCH_WRITE_1 } },
+                                               { FALSE, 2, { MARCH_READ_1, MARCH_WRITE_0 } },
+                                               { TRUE,  2, { MARCH_READ_0, MARCH_WRITE_1 } },
+                                               { TRUE,  2, { MARCH_READ_1, MARCH_WRITE_0 } },
+                                               { FALSE, 1, { MARCH_READ_0 } },
+                                               
+                                               // March B
+                                               { FALSE, 1, { MARCH_WRITE_0 } },
+                                               { FALSE, 6, { MARCH_READ_0, MARCH_WRITE_1, MARCH_READ_1, MARCH_WRITE_0, MARCH_READ_0, MARCH_WRITE_1 } },
+                                               { FALSE, 3, { MARCH_READ_1, MARCH_WRITE_0, MARCH_WRITE_1 } },
+                                               { TRUE,  4, { MARCH_READ_1, MARCH_WRITE_0, MARCH_WRITE_1, MARCH_WRITE_0 } },
+                                               { TRUE,  3, { MARCH_READ_0, MARCH_WRITE_1, MARCH_WRITE_0 } },
+                                               
+                                               // MATS+
+                                               { FALSE, 1, { MARCH_WRITE_0 } },
+                                               { FALSE, 2, { MARCH_READ_0, MARCH_WRITE_1 } },
+                                               { TRUE,  2, { MARCH_READ_1, MARCH_WRITE_0 } }
+                                           };
+                                           
+    const UINT32 BlackfinDiagDataRam::NMBR_MARCH_ELEMENTS = sizeof( MARCH_ELEMENTS ) / sizeof( MarchElement );
+
+    const BlackfinDiagDataRam::MarchAlgorithm BlackfinDiagDataRam::MARCH_ALGORITHMS[] = 
+                                           {
+                                               { 0,  0 },     // DATA_RAM_PATTERN_TEST
+                                               { 0,  6 },     // DATA_RAM_MARCH_C_MINUS
+                                               { 6,  5 },     // DATA_RAM_MARCH_B
+                                               { 11, 3 }      // DATA_RAM_MATS_PLUS
+                                           };
+                                           
+    const UINT32 BlackfinDiagDataRam::MARCH_DATA_BACKGROUNDS[] = { 0, 0x55555555 };
+    
+    const UINT32 BlackfinDiagDataRam::NMBR_MARCH_DATA_BACKGROUNDS = sizeof( MARCH_DATA_BACKGROUNDS ) / sizeof( UINT32 );
+
+    const UINT32 BlackfinDiagDataRam::RETEST_DATA_BACKGROUNDS[] = { 0, 0x55555555, 0x33333333, 0x0f0f0f0f };
+    
+    const UINT32 BlackfinDiagDataRam::NMBR_RETEST_DATA_BACKGROUNDS = sizeof( RETEST_DATA_BACKGROUNDS ) / sizeof( UINT32 );
+
     //***************************************************************************
     // PUBLIC METHODS
     //***************************************************************************
@@ -50,59 +114,47 @@ namespace BlackfinDiagnosticTesting
     {
 	
 	    ConfigForAnyNewDiagCycle( this );
+	    
+	    // The application may change the cache configuration at any time.
+	    ReadCacheConfiguration();
 					
 	    BOOL errorExists = TRUE;
 	
 		DiagnosticTesting::DiagnosticTest::TestState ts = DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
 	
-	    UINT32 offsetFromBankStart = 0;
-	
-	    UINT32 failurePattern = 0;
-	
-	    if ( !m_BankA.m_TestCompleted ) 
-	    { 
-		
-		    errorExists = !RunRamTest( &m_BankA, offsetFromBankStart, failurePattern );
-		 
-		    if ( errorExists ) 
-		    {
-		 	    EncodeErrorInfo( rErrorCode, BANK_A, offsetFromBankStart, failurePattern );
-		 	
-		 	    OS_Assert( rErrorCode );
-		     }
-		 
-		     ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
-		
-	    }
-	    else if ( !m_BankB.m_TestCompleted ) 
-	    { 
-		
-		    errorExists = !RunRamTest( &m_BankB, offsetFromBankStart, failurePattern );
-		 
-		    if ( errorExists ) 
-		    {
-		 	    EncodeErrorInfo( rErrorCode, BANK_B, offsetFromBankStart, failurePattern );
-		 	
-		 	    OS_Assert( rErrorCode );
-		     }
-		 
-		    ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
+	    for ( UINT32 ui = 0; ui < m_NmbrDataRamRegions; ++ui ) 
+	    {
+	        DataRamTestDescriptor * pRegion = &m_pDataRamRegions[ ui ];
+	        
+	        if ( pRegion->m_TestCompleted ) 
+	        {
+	            continue;
+	        }
 		
-	    }
-	    else if ( !m_BankC.m_TestCompleted ) 
-	    { 
-
-		    errorExists = !RunRamTest( &m_BankC, offsetFromBankStart, failurePattern );
+		    DataRamFaultRecord fault = DataRamFaultRecord();
+		    
+		    errorExists = !RunRamTest( pRegion, fault );
 		 
 		    if ( errorExists ) 
 		    {
-		 	    EncodeErrorInfo( rErrorCode, BANK_C, offsetFromBankStart, failurePattern );
+		        _GET_CYCLE_COUNT( fault.m_Timestamp );
+		        
+		        fault.m_RegionNumber = ui + 1;
+		        
+		        // Whether the failure repeats and what else around it fails goes in the error code with it.
+		        RetestFailedWord( pRegion, fault.m_pFailedAddr );
+		        
+		        RecordFault( fault );
+		        
+		 	    EncodeErrorInfo( rErrorCode, ui + 1 );
 		 	
 		 	    OS_Assert( rErrorCode );
 		    }
 		 
 		    ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
-	   }
+		    
+		    break;
+	    }
 
 	   return ts;
     }
@@ -114,77 +166,250 @@ namespace BlackfinDiagnosticTesting
     ///
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    BOOL  BlackfinDiagDataRam::RunRamTest( DataRamTestDescriptor * pTestRAMDescriptor, 
-                                           UINT32 &                rOffsetFromBankStart, 
-                                           UINT32 &                rFailurePattern ) 
+    BOOL  BlackfinDiagDataRam::RunRamTest( DataRamTestDescriptor * pTestRAMDescriptor, DataRamFaultRecord & rFault ) 
     {
-		 
-	    UINT8 testPattern = 0x77;
-		
-	    UINT32 nmbrBytesTestedThisIteration = 0;
+	    UINT8 * pChunkStart = NULL;
+	    
+	    UINT8 * pChunkEnd   = NULL;
+	    
+	    SelectNextChunk( pTestRAMDescriptor, pChunkStart, pChunkEnd );
 	
-	    UINT32 nmbrBytesToTestThisIteration = 0;
+	    BOOL    hadSuccess  = TRUE;
+		
+		//
+		// Excluded bytes and bytes configured as cache in the chunk are skipped, the bytes on either side of them are 
+		// tested separately.  Skipped bytes count as tested.
+		//
+		UINT8 * pTestStartAddr = pChunkStart;
+		
+		while ( hadSuccess && ( pTestStartAddr < pChunkEnd ) ) 
+		{
+		    UINT8 * pTestEndAddr = pChunkEnd;
+		    
+		    pTestStartAddr = ClipToUntestedRanges( pTestStartAddr, pTestEndAddr );
+		    
+		    hadSuccess     = TestRange( pTestRAMDescriptor->m_TestMode, 
+		                                pTestRAMDescriptor->m_FlushCacheLines && m_DataCacheEnabled,
+		                                pTestStartAddr, 
+		                                pTestEndAddr, 
+		                                rFault );
+		    
+		    pTestStartAddr = pTestEndAddr;
+		}
+
+	    if ( hadSuccess ) 
+	    {
+		    pTestRAMDescriptor->m_NmbrBytesTested += pChunkEnd - pChunkStart;
+		    
+		    ++pTestRAMDescriptor->m_ChunkSequenceNumber;
+		
+		    if ( pTestRAMDescriptor->m_NmbrBytesTested >= pTestRAMDescriptor->m_NmbrContiguousBytesToTest ) 
+		    {
+			    pTestRAMDescriptor->m_TestCompleted = TRUE;
+		    }
+	    }
 	
-	    UINT32 nmbrBytesLeftToTest = pTestRAMDescriptor->m_NmbrContiguousBytesToTest - pTestRAMDescriptor->m_NmbrBytesTested;
+	    return hadSuccess;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: SelectNextChunk
+    ///
+    ///      Selects the chunk of a region tested by the next iteration
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::SelectNextChunk( DataRamTestDescriptor * pTestRAMDescriptor, 
+                                               UINT8 * &               rpChunkStart, 
+                                               UINT8 * &               rpChunkEnd ) 
+    {
+        UINT32 chunkOffset = pTestRAMDescriptor->m_NmbrBytesTested;
+        
+        UINT32 nmbrChunks  = ( pTestRAMDescriptor->m_NmbrContiguousBytesToTest + m_NmbrBytesToTestPerIteration - 1 ) 
+                             / m_NmbrBytesToTestPerIteration;
+        
+        if ( ( DATA_RAM_BIT_REVERSED_CHUNKS == pTestRAMDescriptor->m_ChunkOrder ) && ( nmbrChunks > 0 ) ) 
+        {
+            UINT32 nmbrBits   = 0;
+            
+            while ( ( static_cast<UINT32>( 1 ) << nmbrBits ) < nmbrChunks ) 
+            {
+                ++nmbrBits;
+            }
+            
+            //
+            // Sequence numbers run over the next power of two up from the number of chunks.  Those that reverse to 
+            // a chunk past the end of the region are skipped, fewer than half of them are.
+            //
+            UINT32 chunk = ReverseBits( pTestRAMDescriptor->m_ChunkSequenceNumber, nmbrBits );
+            
+            while ( chunk >= nmbrChunks ) 
+            {
+                ++pTestRAMDescriptor->m_ChunkSequenceNumber;
+                
+                chunk = ReverseBits( pTestRAMDescriptor->m_ChunkSequenceNumber, nmbrBits );
+            }
+            
+            chunkOffset = chunk * m_NmbrBytesToTestPerIteration;
+        }
+        
+        UINT32 nmbrBytesInChunk = pTestRAMDescriptor->m_NmbrContiguousBytesToTest - chunkOffset;
+        
+        if ( nmbrBytesInChunk > m_NmbrBytesToTestPerIteration ) 
+        {
+            nmbrBytesInChunk = m_NmbrBytesToTestPerIteration;
+        }
+        
+        rpChunkStart = pTestRAMDescriptor->m_pDataRamAddressStart + chunkOffset;
+        
+        rpChunkEnd   = rpChunkStart + nmbrBytesInChunk;
+    }
 
-	    if ( nmbrBytesLeftToTest >= m_NmbrBytesToTestPerIteration ) 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: ReverseBits
+    ///
+    ///      Reverses the order of the low bits of a value
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRam::ReverseBits( UINT32 value, UINT32 nmbrBits ) 
+    {
+        UINT32 reversed = 0;
+        
+        for ( UINT32 ui = 0; ui < nmbrBits; ++ui ) 
+        {
+            reversed = ( reversed << 1 ) | ( value & 1 );
+            
+            value  >>= 1;
+        }
+        
+        return reversed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestRange
+    ///
+    ///      Tests a range of RAM with a test mode
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestRange( DataRamTestModes testMode,
+                                         BOOL             flushCacheLines,
+                                         UINT8 *          pTestStartAddr, 
+                                         UINT8 *          pTestEndAddr, 
+                                         DataRamFaultRecord & rFault ) 
+    {
+		//
+		// Whole words are tested a block at a time, only the bytes before the first word boundary and after the last 
+		// one are tested a byte at a time.
+		//
+		UINT8 * pFirstWord     = reinterpret_cast<UINT8 *>( ( reinterpret_cast<AddressValue>(pTestStartAddr) + WORD_ALIGNMENT_MASK ) 
+		                                                    & ~static_cast<AddressValue>( WORD_ALIGNMENT_MASK ) );
+		
+		UINT8 * pEndOfWords    = reinterpret_cast<UINT8 *>( reinterpret_cast<AddressValue>(pTestEndAddr) 
+		                                                    & ~static_cast<AddressValue>( WORD_ALIGNMENT_MASK ) );
+		
+		if ( pFirstWord > pEndOfWords ) 
+		{
+		    pFirstWord  = pTestEndAddr;
+		    
+		    pEndOfWords = pTestEndAddr;
+		}
+	
+	    BOOL    hadSuccess     = TestBytes( pTestStartAddr, pFirstWord, rFault );
+	    
+	    if ( hadSuccess ) 
 	    {
-		    nmbrBytesToTestThisIteration = m_NmbrBytesToTestPerIteration;
+	        WordsTestParameters wtp;
+	        
+	        wtp.m_pWordsToTest       = reinterpret_cast<UINT32 *>( pFirstWord );
+	        wtp.m_NmbrWordsToTest    = ( pEndOfWords - pFirstWord ) / sizeof( UINT32 );
+	        wtp.m_pTestPatterns      = m_pTestPatternsRAM;
+	        wtp.m_NmbrTestPatterns   = m_NmbrTestPatterns;
+	        wtp.m_pWordThatFailed    = NULL;
+	        wtp.m_PatternThatFailed  = 0;
+	        wtp.m_ValueReadBack      = 0;
+	        
+	        if (    ( DATA_RAM_PATTERN_TEST == testMode ) 
+	             || ( DATA_RAM_GENERATED_PATTERN_TEST == testMode ) ) 
+	        {
+	            hadSuccess = TestWords( &wtp, DATA_RAM_GENERATED_PATTERN_TEST == testMode );
+	            
+	            if ( !hadSuccess ) 
+	            {
+	                rFault.m_pFailedAddr = reinterpret_cast<UINT8 *>( wtp.m_pWordThatFailed );
+	                rFault.m_Expected    = wtp.m_PatternThatFailed;
+	                rFault.m_ReadBack    = wtp.m_ValueReadBack;
+	                rFault.m_TestMode    = testMode;
+	                rFault.m_AccessBytes = sizeof( UINT32 );
+	                rFault.m_Step        = ( DATA_RAM_PATTERN_TEST == testMode ) 
+	                                       ? FindPatternNumber( wtp.m_PatternThatFailed, 0xffffffff ) 
+	                                       : DATA_RAM_FAULT_NO_STEP;
+	            }
+	        }
+	        else if (    ( DATA_RAM_SAVE_RESTORE_BLOCK_TEST == testMode ) 
+	                  || ( DATA_RAM_MDMA_SAVE_RESTORE_BLOCK_TEST == testMode ) ) 
+	        {
+	            hadSuccess = TestBlock( DATA_RAM_MDMA_SAVE_RESTORE_BLOCK_TEST == testMode,
+	                                    flushCacheLines,
+	                                    wtp.m_pWordsToTest,
+	                                    wtp.m_NmbrWordsToTest,
+	                                    rFault );
+	        }
+	        else 
+	        {
+	            hadSuccess = TestMarch( testMode,
+	                                    wtp.m_pWordsToTest,
+	                                    wtp.m_NmbrWordsToTest,
+	                                    rFault );
+	        }
 	    }
-	    else 
+	    
+	    if ( hadSuccess ) 
 	    {
-		    nmbrBytesToTestThisIteration = nmbrBytesLeftToTest;
+	        hadSuccess = TestBytes( pEndOfWords, pTestEndAddr, rFault );
 	    }
+	    
+	    return hadSuccess;
+    }
 		
-		UINT8 * pTestStartAddr = pTestRAMDescriptor->m_pDataRamAddressStart + pTestRAMDescriptor->m_NmbrBytesTested;
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestBytes
+    ///
+    ///      Tests a range of RAM a byte at a time
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestBytes( UINT8 *              pFirstByte, 
+                                         UINT8 *              pEndOfBytes, 
+                                         DataRamFaultRecord & rFault ) 
+    {
+	    UINT8 testPattern = 0x77;
+	    
+	    UINT8 readBack    = 0;
 		
-	    UINT8 * pCrrntRAMAddr = pTestStartAddr;
-	
-	    BOOL hadSuccess    = TRUE;
-
-	    BOOL testNotPassed = FALSE;
-
         ByteTestParameters         btp;
 	
-	    while ( nmbrBytesTestedThisIteration < m_NmbrBytesToTestPerIteration) 
+	    for ( UINT8 * pCrrntRAMAddr = pFirstByte; pCrrntRAMAddr < pEndOfBytes; ++pCrrntRAMAddr ) 
 	    {
 		    btp.m_pByteToTest          = pCrrntRAMAddr;
 		    btp.m_pPatternThatFailed   = &testPattern;
 		    btp.m_pTestPatterns        = m_pTestPatternsRAM;
 		    btp.m_NmbrTestPatterns     = m_NmbrTestPatterns;
+		    btp.m_pValueReadBack       = &readBack;
 		
-		    testNotPassed = !TestAByte(&btp);
-		
-		    if (testNotPassed) break;
-		
-		    ++nmbrBytesTestedThisIteration;
-		
-		    ++pCrrntRAMAddr;
-	    }
-
-	    if (testNotPassed) 
-	    {
-		    rOffsetFromBankStart = pCrrntRAMAddr - pTestStartAddr;
-		
-		    rFailurePattern = testPattern;
-	
-		    hadSuccess = FALSE;
-	    }
-	    else 
-	    {
-		    pTestRAMDescriptor->m_NmbrBytesTested += nmbrBytesTestedThisIteration;
-		
-		    if ( pTestRAMDescriptor->m_NmbrBytesTested >= pTestRAMDescriptor->m_NmbrContiguousBytesToTest ) 
+		    if ( !TestAByte(&btp) ) 
 		    {
-			    pTestRAMDescriptor->m_TestCompleted = TRUE;
+		        rFault.m_pFailedAddr = pCrrntRAMAddr;
+		        rFault.m_Expected    = testPattern;
+		        rFault.m_ReadBack    = readBack;
+		        rFault.m_TestMode    = DATA_RAM_PATTERN_TEST;
+		        rFault.m_AccessBytes = sizeof( UINT8 );
+		        rFault.m_Step        = FindPatternNumber( testPattern, 0xff );
+		        
+		        return FALSE;
 		    }
 	    }
-	
-	    return hadSuccess;
+	    
+	    return TRUE;
     }
-		
 
-	
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: BlackfinDiagDataRam: TestAByte
     ///
@@ -204,24 +429,688 @@ namespace BlackfinDiagnosticTesting
 	    return testPassed; 
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestMarch
+    ///
+    ///      Tests a range of words of RAM with a march algorithm
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestMarch( DataRamTestModes     testMode,
+                                         UINT32 *             pFirstWord, 
+                                         UINT32               nmbrWords, 
+                                         DataRamFaultRecord & rFault ) 
+    {
+        const MarchElement * pElements    = &MARCH_ELEMENTS[ MARCH_ALGORITHMS[ testMode ].m_FirstElement ];
+        
+        UINT32               nmbrElements = MARCH_ALGORITHMS[ testMode ].m_NmbrElements;
+        
+        BOOL                 testPassed   = TRUE;
+        
+        while ( testPassed && ( nmbrWords > 0 ) ) 
+        {
+            UINT32 nmbrWordsInBlock = ( nmbrWords > SAVE_BUFFER_WORDS ) ? SAVE_BUFFER_WORDS : nmbrWords;
+            
+            nmbrWordsInBlock        = ComputeWordsPerCriticalSection( m_MarchTestCost, nmbrWordsInBlock );
+            
+            if ( IsTestEngineDataInBlock( pFirstWord, nmbrWordsInBlock ) ) 
+            {
+	            testPassed = TestWordsWithPatterns( pFirstWord, nmbrWordsInBlock, rFault );
+            }
+            else 
+            {
+                DisableInterrupts();
+                
+                for ( UINT32 ui = 0; ui < nmbrWordsInBlock; ++ui ) 
+                {
+                    m_SaveBuffer[ ui ] = ReadRamWord( pFirstWord + ui );
+                }
+                
+                for ( UINT32 ui = 0; testPassed && ( ui < NMBR_MARCH_DATA_BACKGROUNDS ); ++ui ) 
+                {
+                    testPassed = RunMarchElements( pElements, 
+                                                   nmbrElements, 
+                                                   pFirstWord, 
+                                                   nmbrWordsInBlock, 
+                                                   MARCH_DATA_BACKGROUNDS[ ui ], 
+                                                   rFault,
+                                                   NULL );
+                    
+                    if ( !testPassed ) 
+                    {
+                        rFault.m_TestMode        = testMode;
+                        
+                        rFault.m_MarchBackground = ui;
+                    }
+                }
+                
+                for ( UINT32 ui = 0; ui < nmbrWordsInBlock; ++ui ) 
+                {
+                    WriteRamWord( pFirstWord + ui, m_SaveBuffer[ ui ] );
+                }
+                
+                UINT32 cycles = EnableInterrupts();
+	        
+	            UpdateCriticalSectionCost( m_MarchTestCost, cycles, nmbrWordsInBlock );
+            }
+            
+            pFirstWord += nmbrWordsInBlock;
+            
+            nmbrWords  -= nmbrWordsInBlock;
+        }
+        
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestBlock
+    ///
+    ///      Tests a range of words of RAM holding live data a block at a time
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestBlock( BOOL                 useMdma,
+                                         BOOL                 flushCacheLines,
+                                         UINT32 *             pFirstWord, 
+                                         UINT32               nmbrWords, 
+                                         DataRamFaultRecord & rFault ) 
+    {
+        BOOL testPassed = TRUE;
+        
+        while ( testPassed && ( nmbrWords > 0 ) ) 
+        {
+            UINT32 nmbrWordsInBlock = ( nmbrWords > SAVE_BUFFER_WORDS ) ? SAVE_BUFFER_WORDS : nmbrWords;
+            
+            nmbrWordsInBlock        = ComputeWordsPerCriticalSection( m_BlockTestCost, nmbrWordsInBlock );
+            
+            if ( IsTestEngineDataInBlock( pFirstWord, nmbrWordsInBlock ) ) 
+            {
+	            testPassed = TestWordsWithPatterns( pFirstWord, nmbrWordsInBlock, rFault );
+            }
+            else 
+            {
+                UINT32            nmbrBytes  = nmbrWordsInBlock * sizeof( UINT32 );
+                
+                WordsTestParameters wtp;
+                
+                wtp.m_pWordsToTest       = pFirstWord;
+                wtp.m_NmbrWordsToTest    = nmbrWordsInBlock;
+                wtp.m_pTestPatterns      = m_pTestPatternsRAM;
+                wtp.m_NmbrTestPatterns   = m_NmbrTestPatterns;
+                wtp.m_pWordThatFailed    = NULL;
+                wtp.m_PatternThatFailed  = 0;
+                wtp.m_ValueReadBack      = 0;
+                
+                DisableInterrupts();
+                
+                //
+                // Dirty lines are written back before the save so a memory DMA save reads the live data.  Lines are 
+                // invalidated before each read back so it reads the physical memory, and before the restore so no 
+                // line holding a test pattern is left behind a memory DMA restore.
+                //
+                if ( flushCacheLines ) 
+                {
+                    FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pFirstWord ), nmbrBytes );
+                }
+                
+                CopyWords( pFirstWord, m_SaveBuffer, nmbrWordsInBlock, useMdma );
+                
+                testPassed = RunBlockKernel( &wtp, flushCacheLines );
+                
+                if ( flushCacheLines ) 
+                {
+                    FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pFirstWord ), nmbrBytes );
+                }
+                
+                CopyWords( m_SaveBuffer, pFirstWord, nmbrWordsInBlock, useMdma );
+                
+                UINT32 cycles = EnableInterrupts();
+	        
+	            UpdateCriticalSectionCost( m_BlockTestCost, cycles, nmbrWordsInBlock );
+	            
+	            if ( !testPassed ) 
+	            {
+	                rFault.m_pFailedAddr = reinterpret_cast<UINT8 *>( wtp.m_pWordThatFailed );
+	                rFault.m_Expected    = wtp.m_PatternThatFailed;
+	                rFault.m_ReadBack    = wtp.m_ValueReadBack;
+	                rFault.m_TestMode    = useMdma ? DATA_RAM_MDMA_SAVE_RESTORE_BLOCK_TEST 
+	                                               : DATA_RAM_SAVE_RESTORE_BLOCK_TEST;
+	                rFault.m_AccessBytes = sizeof( UINT32 );
+	                rFault.m_Step        = FindPatternNumber( wtp.m_PatternThatFailed, 0xffffffff );
+	            }
+            }
+            
+            pFirstWord += nmbrWordsInBlock;
+            
+            nmbrWords  -= nmbrWordsInBlock;
+        }
+        
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: RunBlockKernel
+    ///
+    ///      Writes each pattern of the table over a saved block and reads it back
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::RunBlockKernel( WordsTestParameters * pwtp, BOOL flushCacheLines ) 
+    {
+        volatile UINT32 * pBlock    = pwtp->m_pWordsToTest;
+        
+        UINT32            nmbrWords = pwtp->m_NmbrWordsToTest;
+        
+        for ( UINT32 pattern = 0; pattern < pwtp->m_NmbrTestPatterns; ++pattern ) 
+        {
+            UINT32 testPattern = pwtp->m_pTestPatterns[ pattern ];
+            
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+            {
+                WriteRamWord( pBlock + ui, testPattern );
+            }
+            
+            if ( flushCacheLines ) 
+            {
+                FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pwtp->m_pWordsToTest ), 
+                                                  nmbrWords * sizeof( UINT32 ) );
+            }
+            
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+            {
+                UINT32 readBack = ReadRamWord( pBlock + ui );
+                
+                if ( readBack != testPattern ) 
+                {
+                    pwtp->m_pWordThatFailed   = pwtp->m_pWordsToTest + ui;
+                    
+                    pwtp->m_PatternThatFailed = testPattern;
+                    
+                    pwtp->m_ValueReadBack     = readBack;
+                    
+                    return FALSE;
+                }
+            }
+        }
+        
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: RunWordsKernel
+    ///
+    ///      Tests each word of a window on its own with every pattern of the table
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::RunWordsKernel( WordsTestParameters * pwtp ) 
+    {
+        return TestWordsOfRam( pwtp );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: CopyWords
+    ///
+    ///      Copies a block of words for saving or restoring it, by memory DMA when asked to and available
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::CopyWords( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords, BOOL useMdma ) 
+    {
+        if ( useMdma && m_Mdma.StartCopy( pSource, pDestination, nmbrWords ) && m_Mdma.WaitForCopy() ) 
+        {
+            return;
+        }
+        
+        const volatile UINT32 * pFrom = pSource;
+        
+        volatile UINT32 *       pTo   = pDestination;
+        
+        for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+        {
+            WriteRamWord( pTo + ui, ReadRamWord( pFrom + ui ) );
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: RunMarchElements
+    ///
+    ///      Runs the elements of a march algorithm over a block of words with one data background
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::RunMarchElements( const MarchElement * pElements, 
+                                                UINT32               nmbrElements,
+                                                volatile UINT32 *    pFirstWord, 
+                                                UINT32               nmbrWords, 
+                                                UINT32               background,
+                                                DataRamFaultRecord & rFault,
+                                                UINT32 *             pBitsInError ) 
+    {
+        UINT32 inverse    = ~background;
+        
+        BOOL   testPassed = TRUE;
+        
+        for ( UINT32 element = 0; element < nmbrElements; ++element ) 
+        {
+            const MarchElement & rElement = pElements[ element ];
+            
+            for ( UINT32 word = 0; word < nmbrWords; ++word ) 
+            {
+                UINT32            index = rElement.m_Descending ? ( nmbrWords - 1 - word ) : word;
+                
+                volatile UINT32 * pWord = pFirstWord + index;
+                
+                for ( UINT32 op = 0; op < rElement.m_NmbrOperations; ++op ) 
+                {
+                    UINT32 expected = background;
+                    
+                    switch ( rElement.m_Operations[ op ] ) 
+                    {
+                        case MARCH_WRITE_0:
+                        
+                            WriteRamWord( pWord, background );
+                            
+                            continue;
+                            
+                        case MARCH_WRITE_1:
+                        
+                            WriteRamWord( pWord, inverse );
+                            
+                            continue;
+                            
+                        case MARCH_READ_1:
+                        
+                            expected = inverse;
+                            
+                            break;
+                            
+                        case MARCH_READ_0:
+                        default:
+                        
+                            break;
+                    }
+                    
+                    UINT32 readBack = ReadRamWord( pWord );
+                    
+                    if ( readBack != expected ) 
+                    {
+                        // The first failure is the one recorded, the rest only add to the bits in error.
+                        if ( testPassed ) 
+                        {
+                            rFault.m_pFailedAddr    = reinterpret_cast<UINT8 *>( const_cast<UINT32 *>( pWord ) );
+                            rFault.m_Expected       = expected;
+                            rFault.m_ReadBack       = readBack;
+                            rFault.m_AccessBytes    = sizeof( UINT32 );
+                            rFault.m_Step           = element;
+                            rFault.m_MarchOperation = op;
+                        }
+                        
+                        testPassed = FALSE;
+                        
+                        if ( NULL == pBitsInError ) 
+                        {
+                            return FALSE;
+                        }
+                        
+                        pBitsInError[ index ] |= readBack ^ expected;
+                    }
+                }
+            }
+        }
+        
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: RetestFailedWord
+    ///
+    ///      Marches the words around a failed word again to see if the failure repeats and what else fails
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::RetestFailedWord( DataRamTestDescriptor * pTestRAMDescriptor, UINT8 * pFailedAddr ) 
+    {
+        FaultRetestResult & rRetest = m_LastFaultRetest;
+        
+        rRetest.m_pFailedWord     = reinterpret_cast<UINT32 *>( pFailedAddr );
+        rRetest.m_Retested        = FALSE;
+        rRetest.m_NmbrBackgrounds = 0;
+        rRetest.m_NmbrRepeats     = 0;
+        rRetest.m_BitsInError     = 0;
+        rRetest.m_FailedWordsMask = 0;
+        
+        // Bytes are only tested at the ends of ranges that do not start or end on a word boundary.
+        if ( 0 != ( reinterpret_cast<AddressValue>( pFailedAddr ) & WORD_ALIGNMENT_MASK ) ) 
+        {
+            return;
+        }
+        
+        UINT32  neighbourBytes = RETEST_NEIGHBOUR_WORDS * sizeof( UINT32 );
+        
+        UINT32  offset         = pFailedAddr - pTestRAMDescriptor->m_pDataRamAddressStart;
+        
+        UINT32  bytesAfter     = pTestRAMDescriptor->m_NmbrContiguousBytesToTest - offset - sizeof( UINT32 );
+        
+        UINT8 * pWindowStart   = pFailedAddr - ( ( offset < neighbourBytes ) ? offset : neighbourBytes );
+        
+        UINT8 * pWindowEnd     = pFailedAddr + sizeof( UINT32 ) + ( ( bytesAfter < neighbourBytes ) ? bytesAfter : neighbourBytes );
+        
+        //
+        // Only the stretch of the window between untested ranges that holds the failed word is re-tested.
+        //
+        UINT8 * pStretchStart  = pWindowStart;
+        
+        UINT8 * pStretchEnd    = pWindowStart;
+        
+        while ( pStretchEnd <= pFailedAddr ) 
+        {
+            pStretchStart = pStretchEnd;
+            
+            pStretchEnd   = pWindowEnd;
+            
+            pStretchStart = ClipToUntestedRanges( pStretchStart, pStretchEnd );
+        }
+        
+        UINT32 * pFirstWord   = reinterpret_cast<UINT32 *>( ( reinterpret_cast<AddressValue>(pStretchStart) + WORD_ALIGNMENT_MASK ) 
+                                                            & ~static_cast<AddressValue>( WORD_ALIGNMENT_MASK ) );
+        
+        UINT32 * pEndOfWords  = reinterpret_cast<UINT32 *>( reinterpret_cast<AddressValue>(pStretchEnd) 
+                                                            & ~static_cast<AddressValue>( WORD_ALIGNMENT_MASK ) );
+        
+        UINT32 * pFailedWord  = rRetest.m_pFailedWord;
+        
+        if ( ( pFirstWord > pFailedWord ) || ( pEndOfWords <= pFailedWord ) ) 
+        {
+            return;
+        }
+        
+        UINT32   nmbrWords    = pEndOfWords - pFirstWord;
+        
+        if ( IsTestEngineDataInBlock( pFirstWord, nmbrWords ) ) 
+        {
+            return;
+        }
+        
+        const MarchElement * pElements    = &MARCH_ELEMENTS[ MARCH_ALGORITHMS[ DATA_RAM_MARCH_C_MINUS ].m_FirstElement ];
+        
+        UINT32               nmbrElements = MARCH_ALGORITHMS[ DATA_RAM_MARCH_C_MINUS ].m_NmbrElements;
+        
+        // Bit of the failed words mask for the first word of the stretch, and the failed word in the stretch.
+        UINT32               firstBit     = RETEST_NEIGHBOUR_WORDS - ( pFailedWord - pFirstWord );
+        
+        UINT32               failedIndex  = pFailedWord - pFirstWord;
+        
+        UINT32               bitsInError[ RETEST_WINDOW_WORDS ];
+        
+        DataRamFaultRecord   unusedFault;
+        
+        DisableInterrupts();
+        
+        for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+        {
+            m_SaveBuffer[ ui ] = ReadRamWord( pFirstWord + ui );
+        }
+        
+        for ( UINT32 background = 0; background < NMBR_RETEST_DATA_BACKGROUNDS; ++background ) 
+        {
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+            {
+                bitsInError[ ui ] = 0;
+            }
+            
+            RunMarchElements( pElements, 
+                              nmbrElements, 
+                              pFirstWord, 
+                              nmbrWords, 
+                              RETEST_DATA_BACKGROUNDS[ background ], 
+                              unusedFault,
+                              bitsInError );
+            
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+            {
+                if ( 0 != bitsInError[ ui ] ) 
+                {
+                    rRetest.m_FailedWordsMask |= 1 << ( firstBit + ui );
+                }
+            }
+            
+            if ( 0 != bitsInError[ failedIndex ] ) 
+            {
+                ++rRetest.m_NmbrRepeats;
+                
+                rRetest.m_BitsInError |= bitsInError[ failedIndex ];
+            }
+            
+            ++rRetest.m_NmbrBackgrounds;
+        }
+        
+        for ( UINT32 ui = 0; ui < nmbrWords; ++ui ) 
+        {
+            WriteRamWord( pFirstWord + ui, m_SaveBuffer[ ui ] );
+        }
+        
+        EnableInterrupts();
+        
+        rRetest.m_Retested = TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: RecordFault
+    ///
+    ///      Adds a failure to the fault record ring and puts it in the user data of the crash header
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::RecordFault( const DataRamFaultRecord & rFault ) 
+    {
+        // Memory that is not initialized at start up holds anything until the first failure after power up.
+        if ( DATA_RAM_FAULT_RING_SIGNATURE != s_FaultRing.m_Signature ) 
+        {
+            s_FaultRing.m_Signature          = DATA_RAM_FAULT_RING_SIGNATURE;
+            
+            s_FaultRing.m_NmbrFaultsRecorded = 0;
+        }
+        
+        s_FaultRing.m_Records[ s_FaultRing.m_NmbrFaultsRecorded % DATA_RAM_FAULT_RING_RECORDS ] = rFault;
+        
+        ++s_FaultRing.m_NmbrFaultsRecorded;
+        
+        user_crash_data.param1 = static_cast<UDINT>( reinterpret_cast<AddressValue>( rFault.m_pFailedAddr ) );
+        
+        user_crash_data.param2 = rFault.m_Expected;
+        
+        user_crash_data.param3 = rFault.m_ReadBack;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: IsTestEngineDataInBlock
+    ///
+    ///      Determines if a block of words holds data the test engine uses while the block is saved
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::IsTestEngineDataInBlock( UINT32 * pFirstWord, UINT32 nmbrWords ) 
+    {
+        AddressValue blockStart     = reinterpret_cast<AddressValue>( pFirstWord );
+        
+        AddressValue blockEnd       = blockStart + ( nmbrWords * sizeof( UINT32 ) );
+        
+        // The stack the test engine runs on is around this local variable.
+        AddressValue stackLocation  = reinterpret_cast<AddressValue>( &blockStart );
+        
+        AddressValue inUseStart[]   = 
+                                { 
+                                    reinterpret_cast<AddressValue>( this ), 
+                                    reinterpret_cast<AddressValue>( m_pTestPatternsRAM ),
+                                    reinterpret_cast<AddressValue>( MARCH_ELEMENTS ),
+                                    reinterpret_cast<AddressValue>( MARCH_ALGORITHMS ),
+                                    reinterpret_cast<AddressValue>( MARCH_DATA_BACKGROUNDS ),
+                                    reinterpret_cast<AddressValue>( RETEST_DATA_BACKGROUNDS ),
+                                    stackLocation - TEST_ENGINE_STACK_GUARD_BYTES
+                                };
+                                
+        AddressValue inUseEnd[]     = 
+                                { 
+                                    reinterpret_cast<AddressValue>( this + 1 ), 
+                                    reinterpret_cast<AddressValue>( m_pTestPatternsRAM + m_NmbrTestPatterns ),
+                                    reinterpret_cast<AddressValue>( MARCH_ELEMENTS + NMBR_MARCH_ELEMENTS ),
+                                    reinterpret_cast<AddressValue>( MARCH_ALGORITHMS + DATA_RAM_MATS_PLUS + 1 ),
+                                    reinterpret_cast<AddressValue>( MARCH_DATA_BACKGROUNDS + NMBR_MARCH_DATA_BACKGROUNDS ),
+                                    reinterpret_cast<AddressValue>( RETEST_DATA_BACKGROUNDS + NMBR_RETEST_DATA_BACKGROUNDS ),
+                                    stackLocation + TEST_ENGINE_STACK_GUARD_BYTES
+                                };
+                                
+        for ( UINT32 ui = 0; ui < ( sizeof( inUseStart ) / sizeof( inUseStart[ 0 ] ) ); ++ui ) 
+        {
+            if ( ( blockStart < inUseEnd[ ui ] ) && ( inUseStart[ ui ] < blockEnd ) ) 
+            {
+                return TRUE;
+            }
+        }
+        
+        return FALSE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestWordsWithPatterns
+    ///
+    ///      Tests a range of words of RAM one word at a time with the configured patterns, and the words of the 
+    ///      pattern table itself with patterns built in registers
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestWordsWithPatterns( UINT32 *             pFirstWord, 
+                                                     UINT32               nmbrWords, 
+                                                     DataRamFaultRecord & rFault ) 
+    {
+        AddressValue tableStart = reinterpret_cast<AddressValue>( m_pTestPatternsRAM );
+        
+        AddressValue tableEnd   = reinterpret_cast<AddressValue>( m_pTestPatternsRAM + m_NmbrTestPatterns );
+        
+	    WordsTestParameters wtp;
+	        
+	    wtp.m_pTestPatterns      = m_pTestPatternsRAM;
+	    wtp.m_NmbrTestPatterns   = m_NmbrTestPatterns;
+	    wtp.m_pWordThatFailed    = NULL;
+	    wtp.m_PatternThatFailed  = 0;
+	    wtp.m_ValueReadBack      = 0;
+	    
+	    BOOL testPassed = TRUE;
+	    
+	    while ( testPassed && ( nmbrWords > 0 ) ) 
+	    {
+	        AddressValue wordAddress   = reinterpret_cast<AddressValue>( pFirstWord );
+	        
+	        // A word of the pattern table would be overwritten by the patterns read from it.
+	        BOOL         inTable       = ( tableStart <= wordAddress ) && ( wordAddress < tableEnd );
+	        
+	        // Words up to where the pattern table starts or ends, whichever is next.
+	        AddressValue stretchEnd    = inTable ? tableEnd : tableStart;
+	        
+	        UINT32       nmbrInStretch = nmbrWords;
+	        
+	        if ( ( wordAddress < stretchEnd ) && ( ( ( stretchEnd - wordAddress ) / sizeof( UINT32 ) ) < nmbrWords ) ) 
+	        {
+	            nmbrInStretch = ( stretchEnd - wordAddress ) / sizeof( UINT32 );
+	        }
+	        
+	        wtp.m_pWordsToTest    = pFirstWord;
+	        wtp.m_NmbrWordsToTest = nmbrInStretch;
+	        
+	        testPassed = TestWords( &wtp, inTable );
+	        
+	        if ( !testPassed ) 
+	        {
+	            rFault.m_pFailedAddr = reinterpret_cast<UINT8 *>( wtp.m_pWordThatFailed );
+	            rFault.m_Expected    = wtp.m_PatternThatFailed;
+	            rFault.m_ReadBack    = wtp.m_ValueReadBack;
+	            rFault.m_TestMode    = inTable ? DATA_RAM_GENERATED_PATTERN_TEST : DATA_RAM_PATTERN_TEST;
+	            rFault.m_AccessBytes = sizeof( UINT32 );
+	            rFault.m_Step        = inTable ? DATA_RAM_FAULT_NO_STEP 
+	                                           : FindPatternNumber( wtp.m_PatternThatFailed, 0xffffffff );
+	        }
+	        
+	        pFirstWord += nmbrInStretch;
+	        
+	        nmbrWords  -= nmbrInStretch;
+	    }
+	    
+	    return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: FindPatternNumber
+    ///
+    ///      Finds the number of a pattern in the pattern table
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRam::FindPatternNumber( UINT32 pattern, UINT32 patternMask ) 
+    {
+        for ( UINT32 ui = 0; ui < m_NmbrTestPatterns; ++ui ) 
+        {
+            if ( ( m_pTestPatternsRAM[ ui ] & patternMask ) == ( pattern & patternMask ) ) 
+            {
+                return ui;
+            }
+        }
+        
+        return DATA_RAM_FAULT_NO_STEP;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: TestWords
+    ///
+    ///      Tests a block of words of RAM with the pattern table or with patterns built in registers
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::TestWords( WordsTestParameters * pwtp, BOOL generatePatterns ) 
+    {
+        CriticalSectionCost & rCost = generatePatterns ? m_GeneratedPatternTestCost : m_PatternTestCost;
+        
+        BOOL     testPassed = TRUE;
+        
+        UINT32 * pFirstWord = pwtp->m_pWordsToTest;
+        
+        UINT32   nmbrWords  = pwtp->m_NmbrWordsToTest;
+        
+        while ( testPassed && ( nmbrWords > 0 ) ) 
+        {
+            UINT32 nmbrWordsInWindow = ComputeWordsPerCriticalSection( rCost, nmbrWords );
+            
+            pwtp->m_pWordsToTest    = pFirstWord;
+            
+            pwtp->m_NmbrWordsToTest = nmbrWordsInWindow;
+
+	        DisableInterrupts();
+		
+	        testPassed = generatePatterns ? TestWordsOfRamGeneratedPatterns( pwtp ) : RunWordsKernel( pwtp );
+
+	        UINT32 cycles = EnableInterrupts();
+	        
+	        UpdateCriticalSectionCost( rCost, cycles, nmbrWordsInWindow );
+	        
+	        pFirstWord += nmbrWordsInWindow;
+	        
+	        nmbrWords  -= nmbrWordsInWindow;
+        }
+
+	    return testPassed; 
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: BlackfinDiagDataRam: EncodeErrorInfo
     ///
     ///      Encoding information about a test failure
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    void BlackfinDiagDataRam::EncodeErrorInfo( UINT32 &             errorInfo, 
-                                               DataRamMemoryBanks   memoryBank, 
-                                               UINT32               offsetFromBankStart, 
-                                               UINT32               failurePattern ) 
+    void BlackfinDiagDataRam::EncodeErrorInfo( UINT32 & errorInfo, UINT32 regionNumber ) 
     {
+        const FaultRetestResult & rRetest = m_LastFaultRetest;
+        
         errorInfo  = GetTestType() << DIAG_ERROR_TYPE_BIT_POS;
     
-        errorInfo |= memoryBank << MEMORY_BANK_FAILURE_BIT_POS;
-	
-	    errorInfo |= (failurePattern << TEST_PATTERNS_ERROR_BIT_POS);
-	
-	    errorInfo |= offsetFromBankStart; 
+        errorInfo |= regionNumber << MEMORY_BANK_FAILURE_BIT_POS;
+        
+        errorInfo |= rRetest.m_FailedWordsMask << RETEST_FAILED_WORDS_BIT_POS;
+        
+        errorInfo |= rRetest.m_NmbrRepeats     << RETEST_REPEATS_BIT_POS;
+        
+        errorInfo |= rRetest.m_NmbrBackgrounds << RETEST_BACKGROUNDS_BIT_POS;
+        
+        errorInfo |= ( rRetest.m_Retested ? 1 : 0 ) << RETEST_DONE_BIT_POS;
+        
+        errorInfo |= ( ( rRetest.m_NmbrRepeats > 0 ) ? 1 : 0 ) << RETEST_PERMANENT_BIT_POS;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,27 +1123,325 @@ namespace BlackfinDiagnosticTesting
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     void BlackfinDiagDataRam::ConfigureForNextTestCycle() 
     {
-	    m_BankA.m_TestCompleted     = FALSE;
+	    for ( UINT32 ui = 0; ui < m_NmbrDataRamRegions; ++ui ) 
+	    {
+	        m_pDataRamRegions[ ui ].m_TestCompleted     = FALSE;
 	
-	    m_BankA.m_NmbrBytesTested   = 0;
-		
-	    m_BankB.m_TestCompleted     = FALSE;
-		
-	    m_BankB.m_NmbrBytesTested   = 0;
-		
-	    m_BankC.m_TestCompleted     = FALSE;
+	        m_pDataRamRegions[ ui ].m_NmbrBytesTested   = 0;
+	
+	        m_pDataRamRegions[ ui ].m_ChunkSequenceNumber = 0;
+	    }
+    }
 
-	    m_BankC.m_NmbrBytesTested   = 0;		
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: ClipToExclusionRanges
+    ///
+    ///      Moves the start of a range to test past a list of ranges and ends it at the next one
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 * BlackfinDiagDataRam::ClipToExclusionRanges( const DataRamExclusionRange * pRanges, 
+                                                        UINT32                        nmbrRanges,
+                                                        UINT8 *                       pTestStartAddr, 
+                                                        UINT8 * &                     rpTestEndAddr ) 
+    {
+        //
+        // Ranges may be adjacent or listed in any order, so start over each time the start moves.
+        //
+        UINT32 ui = 0;
+        
+        while ( ( ui < nmbrRanges ) && ( pTestStartAddr < rpTestEndAddr ) ) 
+        {
+            UINT8 * pExcludedStart = pRanges[ ui ].m_pExcludedStart;
+            
+            UINT8 * pExcludedEnd   = pExcludedStart + pRanges[ ui ].m_NmbrExcludedBytes;
+            
+            if ( ( pTestStartAddr >= pExcludedStart ) && ( pTestStartAddr < pExcludedEnd ) ) 
+            {
+                pTestStartAddr = pExcludedEnd;
+                
+                ui             = 0;
+            }
+            else 
+            {
+                ++ui;
+            }
+        }
+        
+        if ( pTestStartAddr >= rpTestEndAddr ) 
+        {
+            return rpTestEndAddr;
+        }
+        
+        for ( ui = 0; ui < nmbrRanges; ++ui ) 
+        {
+            UINT8 * pExcludedStart = pRanges[ ui ].m_pExcludedStart;
+            
+            if ( ( pExcludedStart > pTestStartAddr ) && ( pExcludedStart < rpTestEndAddr ) ) 
+            {
+                rpTestEndAddr = pExcludedStart;
+            }
+        }
+        
+        return pTestStartAddr;
     }
 
-	void BlackfinDiagDataRam::EnableInterrupts() 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: ClipToUntestedRanges
+    ///
+    ///      Moves the start of a range to test past the exclusion and cache ranges and ends it at the next one
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 * BlackfinDiagDataRam::ClipToUntestedRanges( UINT8 * pTestStartAddr, UINT8 * & rpTestEndAddr ) 
+    {
+        //
+        // Moving past a range of one list can move the start into a range of the other, so clip to both until 
+        // the start stops moving.
+        //
+        UINT8 * pPreviousStartAddr = NULL;
+        
+        do 
+        {
+            pPreviousStartAddr = pTestStartAddr;
+            
+            pTestStartAddr     = ClipToExclusionRanges( m_pExclusionRanges, 
+                                                        m_NmbrExclusionRanges, 
+                                                        pTestStartAddr, 
+                                                        rpTestEndAddr );
+            
+            pTestStartAddr     = ClipToExclusionRanges( m_CacheRanges, m_NmbrCacheRanges, pTestStartAddr, rpTestEndAddr );
+        } 
+        while ( pTestStartAddr != pPreviousStartAddr );
+        
+        return pTestStartAddr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: ReadCacheConfiguration
+    ///
+    ///      Reads DMEM_CONTROL to find the parts of banks A and B configured as cache
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::ReadCacheConfiguration() 
+    {
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+        UINT32 dataMemoryConfig = m_SimulatedDmemControl & DMEM_CONTROL_DMC_MASK;
+#else
+        //
+        // Best source for understanding this is the ADSP-BF52X Blackfin Processor Hardware Reference, chapter 6 on
+        // L1 data memory.
+        //
+        UINT32 dataMemoryConfig = *pDMEM_CONTROL & DMEM_CONTROL_DMC_MASK;
+#endif
+        
+        m_NmbrCacheRanges  = 0;
+        
+        m_DataCacheEnabled = FALSE;
+        
+        if (    ( DMEM_CONTROL_A_CACHE_B_SRAM == dataMemoryConfig ) 
+             || ( DMEM_CONTROL_A_CACHE_B_CACHE == dataMemoryConfig ) ) 
+        {
+            m_CacheRanges[ m_NmbrCacheRanges ].m_pExcludedStart    = reinterpret_cast<UINT8 *>( L1_DATA_A_CACHE_START );
+            
+            m_CacheRanges[ m_NmbrCacheRanges ].m_NmbrExcludedBytes = L1_DATA_A_CACHE_END - L1_DATA_A_CACHE_START;
+            
+            ++m_NmbrCacheRanges;
+            
+            m_DataCacheEnabled = TRUE;
+        }
+        
+        if ( DMEM_CONTROL_A_CACHE_B_CACHE == dataMemoryConfig ) 
+        {
+            m_CacheRanges[ m_NmbrCacheRanges ].m_pExcludedStart    = reinterpret_cast<UINT8 *>( L1_DATA_B_CACHE_START );
+            
+            m_CacheRanges[ m_NmbrCacheRanges ].m_NmbrExcludedBytes = L1_DATA_B_CACHE_END - L1_DATA_B_CACHE_START;
+            
+            ++m_NmbrCacheRanges;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: ComputeWordsPerCriticalSection
+    ///
+    ///      Computes how many words fit in one critical section
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRam::ComputeWordsPerCriticalSection( const CriticalSectionCost & rCost, UINT32 nmbrWords ) 
+    {
+        if ( 0 == m_MaxCriticalSectionCycles ) 
+        {
+            return nmbrWords;
+        }
+        
+        // Until a window of one word has been measured, or when one word is all that fits, test one word at a time.
+        if ( ( 0 == rCost.m_OneWordCycles ) || ( rCost.m_OneWordCycles >= m_MaxCriticalSectionCycles ) ) 
+        {
+            return 1;
+        }
+        
+        UINT32 nmbrWordsThatFit = 0;
+        
+        if ( 0 == rCost.m_CyclesPerWord ) 
+        {
+            // No word costs more than a window of one word, the fixed cost included.  The window sized this way 
+            // measures the cost of the words past the first.
+            nmbrWordsThatFit = m_MaxCriticalSectionCycles / rCost.m_OneWordCycles;
+        }
+        else 
+        {
+            nmbrWordsThatFit = 1 + ( ( m_MaxCriticalSectionCycles - rCost.m_OneWordCycles ) / rCost.m_CyclesPerWord );
+        }
+        
+        return ( nmbrWordsThatFit < nmbrWords ) ? nmbrWordsThatFit : nmbrWords;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: UpdateCriticalSectionCost
+    ///
+    ///      Keeps the most cycles measured for a window of one word and per word past the first of a window
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::UpdateCriticalSectionCost( CriticalSectionCost & rCost, UINT32 cycles, UINT32 nmbrWords ) 
+    {
+        if ( 1 == nmbrWords ) 
+        {
+            if ( cycles > rCost.m_OneWordCycles ) 
+            {
+                rCost.m_OneWordCycles = cycles;
+            }
+            
+            return;
+        }
+        
+        UINT32 cyclesPerWord = 0;
+        
+        if ( 0 == rCost.m_OneWordCycles ) 
+        {
+            // Only when windows are not limited, the fixed cost is charged to the words.
+            cyclesPerWord = ( cycles + nmbrWords - 1 ) / nmbrWords;
+        }
+        else if ( cycles > rCost.m_OneWordCycles ) 
+        {
+            cyclesPerWord = ( cycles - rCost.m_OneWordCycles + nmbrWords - 2 ) / ( nmbrWords - 1 );
+        }
+        
+        if ( cyclesPerWord > rCost.m_CyclesPerWord ) 
+        {
+            rCost.m_CyclesPerWord = cyclesPerWord;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: GetWorstCriticalSectionCycles
+    ///
+    ///      Get the longest time in cycles interrupts have been disabled by the test
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRam::GetWorstCriticalSectionCycles() 
+    {
+        return m_WorstCriticalSectionCycles;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: GetPatternTestCyclesPerWord
+    ///
+    ///      Get the most cycles per word measured testing with the pattern table and with generated patterns
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::GetPatternTestCyclesPerWord( UINT32 & rTablePatternCycles, UINT32 & rGeneratedPatternCycles ) 
+    {
+        rTablePatternCycles     = m_PatternTestCost.m_CyclesPerWord;
+        
+        rGeneratedPatternCycles = m_GeneratedPatternTestCost.m_CyclesPerWord;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: GetMdmaStatistics
+    ///
+    ///      Get the counts kept of the blocks saved and restored by memory DMA
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::GetMdmaStatistics( BlackfinDiagMdma::MdmaStatistics & rStatistics ) 
+    {
+        m_Mdma.GetStatistics( rStatistics );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: GetLastFaultRetest
+    ///
+    ///      Get the result of re-testing the words around the last failed word
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::GetLastFaultRetest( FaultRetestResult & rResult ) 
+    {
+        rResult = m_LastFaultRetest;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: GetFaultRecord
+    ///
+    ///      Get one of the last failures recorded, 0 for the latest
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRam::GetFaultRecord( UINT32 nmbrBack, DataRamFaultRecord & rRecord ) 
+    {
+        if ( DATA_RAM_FAULT_RING_SIGNATURE != s_FaultRing.m_Signature ) 
+        {
+            return FALSE;
+        }
+        
+        UINT32 nmbrRecords = s_FaultRing.m_NmbrFaultsRecorded;
+        
+        if ( nmbrRecords > DATA_RAM_FAULT_RING_RECORDS ) 
+        {
+            nmbrRecords = DATA_RAM_FAULT_RING_RECORDS;
+        }
+        
+        if ( nmbrBack >= nmbrRecords ) 
+        {
+            return FALSE;
+        }
+        
+        rRecord = s_FaultRing.m_Records[ ( s_FaultRing.m_NmbrFaultsRecorded - 1 - nmbrBack ) % DATA_RAM_FAULT_RING_RECORDS ];
+        
+        return TRUE;
+    }
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRam: SetSimulatedDmemControl
+    ///
+    ///      Sets the value read for DMEM_CONTROL on the host
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRam::SetSimulatedDmemControl( UINT32 dmemControl ) 
+    {
+        m_SimulatedDmemControl = dmemControl;
+    }
+#endif
+
+	UINT32 BlackfinDiagDataRam::EnableInterrupts() 
 	{
+	    UINT64 timestamp = 0;
+	    
+	    _GET_CYCLE_COUNT( timestamp );
+	    
 		sti(m_Critical);
+		
+		UINT32 cycles = static_cast<UINT32>( timestamp - m_CriticalSectionStart );
+		
+		if ( cycles > m_WorstCriticalSectionCycles ) 
+		{
+		    m_WorstCriticalSectionCycles = cycles;
+		}
+		
+		return cycles;
 	}
 
      void BlackfinDiagDataRam::DisableInterrupts()
 	{
 		m_Critical = cli();
+		
+		_GET_CYCLE_COUNT( m_CriticalSectionStart );
 	}
 
 }
@@ -6,13 +6,30 @@
 ///
 /// @par Full Description
 /// 
-/// Diagnostic testing for the Blackfin data ram regions bank A, bank B and bank C.  Refer to the hardware
+/// Diagnostic testing for Blackfin data ram regions, by default bank A, bank B and bank C.  Refer to the hardware
 //  reference manual for a detailed description of these regions.  The test writes test patterns to RAM and
-/// reads them back after writing.  If there are miscompares then an error is reported.  An C callable
-//  assembly language routine is called which does the reading and writing for a byte as all the values
-//  are saved in registers.  One byte is tested with data patterns at a time, interrupts are disabled during
-//  the testing of a byte and re-enabled when a byte is tested.  The test is run in iterations that are 
-//  test a number of bytes are passed in when the test object is instantiated.
+/// reads them back after writing.  If there are miscompares then an error is reported.  C callable assembly
+//  language routines do the reading and writing as all the values are saved in registers.  The whole words of an 
+//  iteration are tested in one call with 32 bit patterns, interrupts are disabled during the call and re-enabled 
+//  when the words are tested.  Bytes before the first word boundary and after the last one are tested one byte 
+//  at a time.  The test is run in iterations that are test a number of bytes are passed in when the test object 
+//  is instantiated.  Ranges holding live data that must never be overwritten, like data written by handlers that
+//  can not be masked, are excluded from testing.  Regions holding other live data can be tested a block at a time,
+//  the block is saved, tested with every pattern and restored with interrupts disabled.  The block may be saved 
+//  and restored by memory DMA instead of by the core.  Regions can be marched instead, a block at a time, each block
+//  is saved, marched with each data background and restored with interrupts disabled.  A block is at most 
+//  SAVE_BUFFER_WORDS words and fewer when the critical section bound is tight, so the march only covers coupling and
+//  address decoder faults between words of the same block, those between words of different blocks are not 
+//  detected.  The chunks of a region tested by each iteration are visited in ascending order or in bit reversed 
+//  order, which spreads the chunks tested early in a cycle over the region.
+//  The parts of banks A and B that DMEM_CONTROL configures as cache are skipped while they are cache.  Regions the 
+//  data cache can hold may have each block flushed and invalidated from the cache around the save, the read back 
+//  of each pattern and the restore, so the physical memory is tested rather than lines in the cache.  Before a 
+//  failure is reported the words around the failed word are marched again with several data backgrounds, whether 
+//  the failure repeats and which neighbouring words fail are encoded in the error code.  Each failure is kept in a
+//  fault record, the region, the full address, the value expected and the value read back, the step of the test
+//  that found it and when.  The last few records are kept in a ring in memory that is not initialized at start up,
+//  and the address, expected and read back values of the newest go in the user data of the crash header.
 /// Set and Get methods.
 ///
 /// @if REVISION_HISTORY_INCLUDED
@@ -34,40 +51,200 @@
  
 // C++ PROJECT INCLUDES
 #include "DiagnosticTesting.hpp"
+#include "BlackfinDiagMdma.hpp"
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+#include "BlackfinDiagRamSimulator.hpp"
+#endif
 
 // FORWARD REFERENCES
 // (none)
 	
 namespace BlackfinDiagnosticTesting 
 {
-    static const UINT32 MEMORY_BANK_FAILURE_BIT_POS = 30;
-    static const UINT32 TEST_PATTERNS_ERROR_BIT_POS = 16;
+    static const UINT32 MEMORY_BANK_FAILURE_BIT_POS = 22;      // Region number, 1 for the first region, 4 bits
+    static const UINT32 WORD_ALIGNMENT_MASK         = 0x3;
+    static const UINT32 MAX_MARCH_OPERATIONS        = 6;       // Most operations in one march element (March B)
+    static const UINT32 NMBR_GENERATED_PATTERNS     = 68;      // Ones, zeros, 2 checkerboards, 32 walking ones and zeros
+    static const UINT32 SAVE_BUFFER_WORDS           = 0x100;   // Words saved, tested and restored at a time
+    static const UINT32 TEST_ENGINE_STACK_GUARD_BYTES = 0x200; // Stack around the test engine that is not overwritten
+    static const UINT32 DMEM_CONTROL_DMC_MASK       = 0xc;     // Data memory configuration field of DMEM_CONTROL
+    static const UINT32 DMEM_CONTROL_A_CACHE_B_SRAM = 0x8;
+    static const UINT32 DMEM_CONTROL_A_CACHE_B_CACHE = 0xc;
+    static const UINT32 L1_DATA_A_CACHE_START       = 0xff804000; // Upper 16K of bank A can be configured as cache
+    static const UINT32 L1_DATA_A_CACHE_END         = 0xff808000;
+    static const UINT32 L1_DATA_B_CACHE_START       = 0xff904000; // Upper 16K of bank B can be configured as cache
+    static const UINT32 L1_DATA_B_CACHE_END         = 0xff908000;
+    static const UINT32 MAX_CACHE_RANGES            = 2;
+    static const UINT32 RETEST_NEIGHBOUR_WORDS      = 4;       // Words re-tested on each side of a failed word
+    static const UINT32 RETEST_WINDOW_WORDS         = ( 2 * RETEST_NEIGHBOUR_WORDS ) + 1;
+    static const UINT32 RETEST_FAILED_WORDS_BIT_POS = 0;       // Error code, words of the window that failed, 9 bits
+    static const UINT32 RETEST_REPEATS_BIT_POS      = 12;      // Backgrounds the failed word failed again with, 4 bits
+    static const UINT32 RETEST_BACKGROUNDS_BIT_POS  = 16;      // Backgrounds re-tested with, 4 bits
+    static const UINT32 RETEST_DONE_BIT_POS         = 20;      // Set when the window could be re-tested
+    static const UINT32 RETEST_PERMANENT_BIT_POS    = 21;      // Set when the failure repeated
+    static const UINT32 DATA_RAM_FAULT_RING_RECORDS = 4;       // Most recent failures kept
+    static const UINT32 DATA_RAM_FAULT_RING_SIGNATURE = 0x46524e47; // The ring has been initialized since power up
+    static const UINT32 DATA_RAM_FAULT_NO_STEP      = 0xffffffff; // Generated patterns, identified by the value expected
+
+	//
+	// Words of the RAM being tested are read and written through these.  On the host they go through the RAM 
+	// simulator so faults injected in the simulated memory are seen by the test.
+	//
+	static inline UINT32 ReadRamWord( const volatile UINT32 * pWord ) 
+	{
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	    return BlackfinDiagRamSimulator::ReadWord( pWord );
+#else
+	    return *pWord;
+#endif
+	}
+
+	static inline void WriteRamWord( volatile UINT32 * pWord, UINT32 value ) 
+	{
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	    BlackfinDiagRamSimulator::WriteWord( pWord, value );
+#else
+	    *pWord = value;
+#endif
+	}
 
     class BlackfinDiagDataRam : public DiagnosticTesting::DiagnosticTest 
     {
         public:      
 
-            // For banks A, B, and C memory regions
+            // How the whole words of a memory region are tested
+            typedef enum 
+            {
+                DATA_RAM_PATTERN_TEST = 0,      // Each word on its own with the test pattern list
+                DATA_RAM_MARCH_C_MINUS,         // March C- {(w0); U(r0,w1); U(r1,w0); D(r0,w1); D(r1,w0); (r0)}
+                DATA_RAM_MARCH_B,               // March B  {(w0); U(r0,w1,r1,w0,r0,w1); U(r1,w0,w1); D(r1,w0,w1,w0); D(r0,w1,w0)}
+                DATA_RAM_MATS_PLUS,             // MATS+    {(w0); U(r0,w1); D(r1,w0)}
+                DATA_RAM_SAVE_RESTORE_BLOCK_TEST, // Block saved, each pattern written over the block and read back, restored
+                DATA_RAM_MDMA_SAVE_RESTORE_BLOCK_TEST, // As above with the block saved and restored by memory DMA
+                DATA_RAM_GENERATED_PATTERN_TEST // Each word on its own with patterns built in registers, no table
+            } 
+            DataRamTestModes;
+
+            // Order the chunks of a memory region are tested in, each chunk is tested once per diagnostic cycle.
+            typedef enum 
+            {
+                DATA_RAM_ASCENDING_CHUNKS = 0,  // From the start of the region up
+                DATA_RAM_BIT_REVERSED_CHUNKS    // The chunk number is the bit reversed sequence number, 0, N/2, N/4 ...
+            } 
+            DataRamChunkOrders;
+
+            // For data RAM memory regions, like the SRAM and cache capable parts of banks A and B, and bank C
             typedef struct 
             {
-    	        UINT8 * m_pDataRamAddressStart;
-    	        UINT32  m_NmbrContiguousBytesToTest;
-    	        UINT32  m_NmbrBytesTested;
-    	        BOOL    m_TestCompleted;
+    	        UINT8 *          m_pDataRamAddressStart;
+    	        UINT32           m_NmbrContiguousBytesToTest;
+    	        UINT32           m_NmbrBytesTested;
+    	        BOOL             m_TestCompleted;
+    	        DataRamTestModes m_TestMode;
+    	        DataRamChunkOrders m_ChunkOrder;
+    	        BOOL             m_FlushCacheLines;     // Block modes only, for regions the data cache can hold
+    	        UINT32           m_ChunkSequenceNumber;
             } 
             DataRamTestDescriptor;
             
+            // A range of data RAM that is never tested, it holds live data that can change with interrupts disabled.
+            typedef struct 
+            {
+    	        UINT8 *          m_pExcludedStart;
+    	        UINT32           m_NmbrExcludedBytes;
+            } 
+            DataRamExclusionRange;
+            
+            // Operations of a march element.  0 is the data background and 1 its complement.
+            typedef enum 
+            {
+                MARCH_READ_0,
+                MARCH_READ_1,
+                MARCH_WRITE_0,
+                MARCH_WRITE_1
+            } 
+            MarchOperations;
+            
+            // A march element is its operations applied to each word in ascending or descending address order.
+            typedef struct 
+            {
+                BOOL             m_Descending;
+                UINT32           m_NmbrOperations;
+                MarchOperations  m_Operations[ MAX_MARCH_OPERATIONS ];
+            } 
+            MarchElement;
+            
+            // Where the elements of a march algorithm are in the table of march elements.
+            typedef struct 
+            {
+                UINT32           m_FirstElement;
+                UINT32           m_NmbrElements;
+            } 
+            MarchAlgorithm;
+            
+            // Result of re-testing the words around a failed word before the failure is reported.  A failure that 
+            // does not repeat is taken to be transient, one that does to be permanent.
+            typedef struct 
+            {
+                UINT32 *         m_pFailedWord;
+                BOOL             m_Retested;            // FALSE when the words around it could not be re-tested
+                UINT32           m_NmbrBackgrounds;     // Data backgrounds the words were marched with
+                UINT32           m_NmbrRepeats;         // Backgrounds the failed word failed again with
+                UINT32           m_BitsInError;         // Bits of the failed word read back wrong by the re-test
+                UINT32           m_FailedWordsMask;     // Bit N for the word N - RETEST_NEIGHBOUR_WORDS from it
+            } 
+            FaultRetestResult;
+            
+            // A data RAM test failure.  Fixed size so the records can be read back from memory after a reset.
+            typedef struct 
+            {
+                UINT64           m_Timestamp;           // Cycle count when the failure was found
+                UINT8 *          m_pFailedAddr;         // Word, or byte at the ends of a range, that failed
+                UINT32           m_Expected;            // Pattern written, or the value the march read expected
+                UINT32           m_ReadBack;            // Value actually read
+                UINT32           m_RegionNumber;        // 1 for the first region of the test that found it
+                DataRamTestModes m_TestMode;            // Mode that found it, word patterns for engine data blocks
+                UINT32           m_AccessBytes;         // 4 for a word, 1 for a byte
+                UINT32           m_Step;                // Pattern number in the table, or march element number
+                UINT32           m_MarchOperation;      // Operation number in the march element
+                UINT32           m_MarchBackground;     // Data background number of the march
+            } 
+            DataRamFaultRecord;
+            
+            // The last failures found by any data RAM test.
+            typedef struct 
+            {
+                UINT32             m_Signature;         // DATA_RAM_FAULT_RING_SIGNATURE once initialized
+                UINT32             m_NmbrFaultsRecorded; // The newest is at this - 1 modulo the ring size
+                DataRamFaultRecord m_Records[ DATA_RAM_FAULT_RING_RECORDS ];
+            } 
+            DataRamFaultRing;
+            
     
  	        // For testing each byte of RAM
  	        typedef struct 
  	        {
 		              UINT8  * m_pByteToTest;
 		              UINT8  * m_pPatternThatFailed;
-		        const UINT8  * m_pTestPatterns;
+		        const UINT32 * m_pTestPatterns;
 		              UINT32   m_NmbrTestPatterns;
+		              UINT8  * m_pValueReadBack;
 	        } 
 	        ByteTestParameters;
 
+ 	        // For testing a block of words of RAM
+ 	        typedef struct 
+ 	        {
+		              UINT32 * m_pWordsToTest;
+		              UINT32   m_NmbrWordsToTest;
+		        const UINT32 * m_pTestPatterns;
+		              UINT32   m_NmbrTestPatterns;
+		              UINT32 * m_pWordThatFailed;
+		              UINT32   m_PatternThatFailed;
+		              UINT32   m_ValueReadBack;
+	        } 
+	        WordsTestParameters;
+
 	        //***************************************************************************
             // PUBLIC METHODS
             //***************************************************************************
@@ -80,32 +257,61 @@ namespace BlackfinDiagnosticTesting
             ///      data RAM.  It is derived from the DiagnosticTesting::DiagnosticTest base class.
             ///      
             ///
-            /// @param bankA                        BankA Data RAM memory region
-            ///        bankB                        BankB Data RAM memory region
-            ///        bankC                        BankC Data RAM memory region
-            ///        pTestPatternsForRamTesting   The array of test patterns to be written and read to each RAM location. 
+            /// @param pDataRamRegions              Array of the Data RAM memory regions to test, tested in order.
+            ///        nmbrDataRamRegions           Number of regions in the array, at most 7.
+            ///        pExclusionRanges             Array of ranges within the regions that are not tested, NULL for 
+            ///                                     none.
+            ///        nmbrExclusionRanges          Number of ranges in the array.
+            ///        pTestPatternsForRamTesting   The array of 32 bit test patterns to be written and read to each RAM 
+            ///                                     location.  Each pattern is a byte replicated across the word, the 
+            ///                                     low byte is used when testing a byte.
             ///        nmbrRamTestingPatterns       Size of the the array of test patterns.
             ///        nmbrBytesToTestPerIternation Number of bytes of Ram per iteration of the test.
+            ///        maxCriticalSectionCycles     Most cycles interrupts are to be disabled for at a time, 0 for no 
+            ///                                     limit.  Words are tested in as many windows as needed to stay 
+            ///                                     within the limit.  A single word or byte is always tested at once.
             ///        ExecuteTestData              Initial runtime data passed to the base for running this test.
             ///                               
             /// @return                             Blackfin Data Ram diagnostic instance created.
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-	        BlackfinDiagDataRam( DataRamTestDescriptor      bankA,
-	                             DataRamTestDescriptor      bankB,
-	                             DataRamTestDescriptor      bankC,
-	                             const UINT8 *              pTestPatternsForRamTesting,
+	        BlackfinDiagDataRam( DataRamTestDescriptor *    pDataRamRegions,
+	                             UINT32                     nmbrDataRamRegions,
+	                             const DataRamExclusionRange * pExclusionRanges,
+	                             UINT32                     nmbrExclusionRanges,
+	                             const UINT32 *             pTestPatternsForRamTesting,
 	                             UINT32                     nmbrRamTestingPatterns,
 	                             UINT32                     nmbrBytesToTestPerIteration,
+	                             UINT32                     maxCriticalSectionCycles,
 		    		             DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData )    
 						         :  DiagnosticTesting::DiagnosticTest ( rTestData ),
-	                       	        m_BankA                           ( bankA ),
-	                       	        m_BankB                           ( bankB ),
-	                       	        m_BankC                           ( bankC ),
+	                       	        m_pDataRamRegions                 ( pDataRamRegions ),
+	                       	        m_NmbrDataRamRegions              ( nmbrDataRamRegions ),
+	                       	        m_pExclusionRanges                ( pExclusionRanges ),
+	                       	        m_NmbrExclusionRanges             ( nmbrExclusionRanges ),
 	                       	        m_NmbrBytesToTestPerIteration     ( nmbrBytesToTestPerIteration ),
 							        m_NmbrTestPatterns                ( nmbrRamTestingPatterns ),
-							        m_pTestPatternsRAM                ( pTestPatternsForRamTesting )//,
+							        m_pTestPatternsRAM                ( pTestPatternsForRamTesting ),
+							        m_MaxCriticalSectionCycles        ( maxCriticalSectionCycles ),
+							        m_WorstCriticalSectionCycles      ( 0 ),
+							        m_CriticalSectionStart            ( 0 ),
+							        m_PatternTestCost                 ( CriticalSectionCost() ),
+							        m_MarchTestCost                   ( CriticalSectionCost() ),
+							        m_BlockTestCost                   ( CriticalSectionCost() ),
+							        m_GeneratedPatternTestCost        ( CriticalSectionCost() ),
+							        m_NmbrCacheRanges                 ( 0 ),
+							        m_DataCacheEnabled                ( FALSE )
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+							        ,
+							        m_SimulatedDmemControl            ( 0 )
+#endif
 	        {
+	            m_LastFaultRetest.m_pFailedWord     = NULL;
+	            m_LastFaultRetest.m_Retested        = FALSE;
+	            m_LastFaultRetest.m_NmbrBackgrounds = 0;
+	            m_LastFaultRetest.m_NmbrRepeats     = 0;
+	            m_LastFaultRetest.m_BitsInError     = 0;
+	            m_LastFaultRetest.m_FailedWordsMask = 0;
 	        }
 
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +329,98 @@ namespace BlackfinDiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 	        DiagnosticTest::TestState RunTest( UINT32 & ErrorCode  );
 
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: GetWorstCriticalSectionCycles
+            ///
+            /// @par Full Description
+            ///      Get the longest time interrupts have been disabled by the test since it was constructed.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           Worst case critical section length in cycles
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 GetWorstCriticalSectionCycles();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: GetPatternTestCyclesPerWord
+            ///
+            /// @par Full Description
+            ///      Get the most cycles per word measured testing words one at a time with the pattern table and with
+            ///      patterns built in registers, past the fixed cost of a critical section.  Dividing by the number of
+            ///      patterns, the table size or NMBR_GENERATED_PATTERNS, gives the cost of a pattern so the two can be
+            ///      compared.
+            ///      
+            ///
+            /// @param      rTablePatternCycles       Set to the cycles per word with the pattern table, 0 if not run.
+            ///             rGeneratedPatternCycles   Set to the cycles per word with generated patterns, 0 if not run.
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetPatternTestCyclesPerWord( UINT32 & rTablePatternCycles, UINT32 & rGeneratedPatternCycles );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: GetMdmaStatistics
+            ///
+            /// @par Full Description
+            ///      Get the counts kept of the blocks saved and restored by memory DMA.
+            ///      
+            ///
+            /// @param      rStatistics           Filled in with the counts.
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetMdmaStatistics( BlackfinDiagMdma::MdmaStatistics & rStatistics );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: GetLastFaultRetest
+            ///
+            /// @par Full Description
+            ///      Get the result of re-testing the words around the last failed word.
+            ///      
+            ///
+            /// @param      rResult               Filled in with the result, all 0 when no failure has been found.
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetLastFaultRetest( FaultRetestResult & rResult );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: GetFaultRecord
+            ///
+            /// @par Full Description
+            ///      Get one of the records of the last failures found by any data RAM test.  The records survive a 
+            ///      reset that does not remove power, so the failure that caused a crash can be read after it.
+            ///      
+            ///
+            /// @param      nmbrBack              0 for the newest record, 1 for the one before it and so on.
+            ///             rRecord               Filled in with the record.
+            ///                               
+            /// @return                           FALSE when there is no such record
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static BOOL GetFaultRecord( UINT32 nmbrBack, DataRamFaultRecord & rRecord );
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: SetSimulatedDmemControl
+            ///
+            /// @par Full Description
+            ///      Host build only.  Sets the value read for DMEM_CONTROL, it reads as all SRAM until set.
+            ///      
+            ///
+            /// @param      dmemControl           Value read for DMEM_CONTROL.
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void SetSimulatedDmemControl( UINT32 dmemControl );
+#endif
+
 	
         protected:
 
@@ -145,6 +443,38 @@ namespace BlackfinDiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 	        void ConfigureForNextTestCycle();
 	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: RunWordsKernel
+            ///
+            /// @par Full Description
+            ///      Tests each word of a window on its own with every pattern of the table, called with interrupts 
+            ///      disabled.  Each word is saved and restored.  The assembly language routine runs the table in a 
+            ///      loop, a derived class with the patterns fixed at compile time can replace it.
+            ///
+            /// @param        pwtp              Test information required for testing the words of RAM.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        virtual BOOL RunWordsKernel( WordsTestParameters * pwtp );
+	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: RunBlockKernel
+            ///
+            /// @par Full Description
+            ///      Writes each pattern of the table over a saved block and reads it back, called with interrupts 
+            ///      disabled between the save and the restore.  A derived class with the patterns and block size 
+            ///      fixed at compile time can replace it.
+            ///
+            /// @param        pwtp              Test information required for testing the words of RAM.
+            ///               flushCacheLines   TRUE to flush and invalidate the block from the data cache before 
+            ///                                 each read back.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        virtual BOOL RunBlockKernel( WordsTestParameters * pwtp, BOOL flushCacheLines );
+	
         private:
 
 	        //
@@ -157,25 +487,27 @@ namespace BlackfinDiagnosticTesting
 	
             BlackfinDiagDataRam();
             
-            // An enumeration for cycling through data ram regions for testing
-             typedef enum 
-	        { 
-	        	BANK_A = 1, 
-	        	BANK_B = 2, 
-	        	BANK_C = 3 
-	        } 
-	        DataRamMemoryBanks;
-		
-	        	        	        
+            // Cost of a kind of critical section, a fixed cost of disabling interrupts, setting up and restoring plus a 
+            // cost per word tested.
+            typedef struct
+            {
+                UINT32                 m_OneWordCycles;   // Most cycles measured for a window of one word
+                UINT32                 m_CyclesPerWord;   // Most cycles measured per word past the first of a window
+            }
+            CriticalSectionCost;
+            
             // For saving status of processor when interrupts are disabled and restoring the state when re-enabling.
             INT                        m_Critical; 
             
-            // Descriptor for testing individual memory banks.  
-            DataRamTestDescriptor      m_BankA;
+            // Descriptors for testing individual memory regions.  
+            DataRamTestDescriptor *    m_pDataRamRegions;
+            
+            UINT32                     m_NmbrDataRamRegions;
             
-            DataRamTestDescriptor      m_BankB;
+            // Ranges within the memory regions that are not tested.
+            const DataRamExclusionRange * m_pExclusionRanges;
             
-            DataRamTestDescriptor      m_BankC;                   
+            UINT32                     m_NmbrExclusionRanges;
 
 	        // Number of test patterns in the test pattern array.
 	        UINT32                     m_NmbrTestPatterns;
@@ -184,34 +516,254 @@ namespace BlackfinDiagnosticTesting
 	        UINT32                     m_NmbrBytesToTestPerIteration;
 
 	        // The test pattern array
-	        const UINT8 *              m_pTestPatternsRAM;
+	        const UINT32 *             m_pTestPatternsRAM;
+
+	        // March elements of all the march algorithms.
+	        static const MarchElement   MARCH_ELEMENTS[];
+	        
+	        // Number of march elements of all the march algorithms.
+	        static const UINT32         NMBR_MARCH_ELEMENTS;
+	        
+	        // March algorithms indexed by DataRamTestModes up to DATA_RAM_MATS_PLUS, DATA_RAM_PATTERN_TEST has no elements.
+	        static const MarchAlgorithm MARCH_ALGORITHMS[];
+	        
+	        // Each march algorithm is run once per data background.  The second background puts neighbouring bits 
+	        // in a word at opposite values so faults coupling bits within a word are detected too.
+	        static const UINT32         MARCH_DATA_BACKGROUNDS[];
+	        
+	        // Number of data backgrounds.
+	        static const UINT32         NMBR_MARCH_DATA_BACKGROUNDS;
+	        
+	        // March C- is run once per data background over the words around a failed word.  Besides the march 
+	        // backgrounds these put pairs and nibbles of bits at opposite values.
+	        static const UINT32         RETEST_DATA_BACKGROUNDS[];
+	        
+	        // Number of re-test data backgrounds.
+	        static const UINT32         NMBR_RETEST_DATA_BACKGROUNDS;
+	        
+	        // Most cycles interrupts are to be disabled for at a time, 0 for no limit.
+	        UINT32                     m_MaxCriticalSectionCycles;
+	        
+	        // Longest critical section measured.
+	        UINT32                     m_WorstCriticalSectionCycles;
+	        
+	        // Cycle count when interrupts were last disabled.
+	        UINT64                     m_CriticalSectionStart;
+	        
+	        // Cost of testing words with the test patterns, of marching them, of testing them a block at a time and of 
+	        // testing them with generated patterns.  Used to size the windows of words tested with interrupts disabled.
+	        CriticalSectionCost        m_PatternTestCost;
+	        
+	        CriticalSectionCost        m_MarchTestCost;
+	        
+	        CriticalSectionCost        m_BlockTestCost;
+	        
+	        CriticalSectionCost        m_GeneratedPatternTestCost;
+	        
+	        // Contents of the words being marched or block tested are saved here and restored afterwards.
+	        UINT32                     m_SaveBuffer[ SAVE_BUFFER_WORDS ];
+	        
+	        // Saves and restores blocks by memory DMA.
+	        BlackfinDiagMdma           m_Mdma;
+	        
+	        // Parts of banks A and B configured as cache when DMEM_CONTROL was last read, they are not tested.
+	        DataRamExclusionRange      m_CacheRanges[ MAX_CACHE_RANGES ];
+	        
+	        UINT32                     m_NmbrCacheRanges;
+	        
+	        // TRUE when DMEM_CONTROL has either bank configured as cache.
+	        BOOL                       m_DataCacheEnabled;
+	        
+	        // Re-test of the words around the last failed word.
+	        FaultRetestResult          m_LastFaultRetest;
+	        
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	        UINT32                     m_SimulatedDmemControl;
+#endif
 
             inline void DisableInterrupts(); 
 	
-	        inline void EnableInterrupts();
+	        inline UINT32 EnableInterrupts();
 	
 	        //***************************************************************************
             // PRIVATE METHODS
             //***************************************************************************
             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: ClipToExclusionRanges
+            ///
+            /// @par Full Description
+            ///      Moves the start of a range of bytes to test past any range of a list it is in and ends the range 
+            ///      at the next range of the list.
+            ///
+            /// @param        pRanges         Ranges that are not tested.
+            ///               nmbrRanges      Number of ranges in the list.
+            ///               pTestStartAddr  First byte of the range to test.
+            ///               rpTestEndAddr   Byte after the last byte of the range to test, moved back to the start 
+            ///                               of the next exclusion range in the range.
+            ///                               
+            /// @return       First byte to test, equal to rpTestEndAddr when the whole range is excluded.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT8 * ClipToExclusionRanges( const DataRamExclusionRange * pRanges, 
+                                           UINT32                        nmbrRanges,
+                                           UINT8 *                       pTestStartAddr, 
+                                           UINT8 * &                     rpTestEndAddr );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: ClipToUntestedRanges
+            ///
+            /// @par Full Description
+            ///      Moves the start of a range of bytes to test past the exclusion ranges and the parts of the banks 
+            ///      configured as cache, and ends the range at the next of either.
+            ///
+            /// @param        pTestStartAddr  First byte of the range to test.
+            ///               rpTestEndAddr   Byte after the last byte of the range to test, moved back to the start 
+            ///                               of the next untested range in the range.
+            ///                               
+            /// @return       First byte to test, equal to rpTestEndAddr when the whole range is untested.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT8 * ClipToUntestedRanges( UINT8 * pTestStartAddr, UINT8 * & rpTestEndAddr );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: ReadCacheConfiguration
+            ///
+            /// @par Full Description
+            ///      Reads DMEM_CONTROL to find the parts of banks A and B configured as cache and whether the data 
+            ///      cache is enabled.
+            ///
+            /// @param        None
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void ReadCacheConfiguration();
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: ComputeWordsPerCriticalSection
+            ///
+            /// @par Full Description
+            ///      Computes how many words can be tested with interrupts disabled and stay within the maximum 
+            ///      critical section length.  The first window of a kind of testing is one word, to measure the fixed
+            ///      cost of a window.  Until the cost of the words past the first has been measured no word is taken to
+            ///      cost more than that window did.
+            ///
+            /// @param        rCost           Cost measured for the kind of testing.
+            ///               nmbrWords       Words left to test.
+            ///                               
+            /// @return       Number of words to test in the next critical section, at least 1.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32 ComputeWordsPerCriticalSection( const CriticalSectionCost & rCost, UINT32 nmbrWords );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: CopyWords
+            ///
+            /// @par Full Description
+            ///      Copies a block of words for saving or restoring it.  When asked to, memory DMA does the copy, the 
+            ///      core copies the block when DMA is busy, can not reach the block or does not complete.
+            ///
+            /// @param        pSource         First word to copy from.
+            ///               pDestination    First word to copy to.
+            ///               nmbrWords       Number of words to copy.
+            ///               useMdma         TRUE to copy with memory DMA when it is available.
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void CopyWords( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords, BOOL useMdma );
+                          
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagDataRam: EncodeErrorInfo
             ///
             /// @par Full Description
             ///      Encoding information about a test failure
             ///
-            /// @param        rErrorInfo          A reference for passing back error info to the caller.
-            ///               memoryBank          The bank where the failure occurred.
-            ///               offsetFromBankStart Offset from the start of the memory bank where the failure was detected
-            ///               failurePattern      The pattern that caused the failure
+            /// @param        rErrorInfo          A reference for passing back error info to the caller, the test type,
+            ///                                   the region and the result of the last re-test.
+            ///               regionNumber        The region where the failure occurred, 1 for the first region.
             ///                               
             /// @return       None
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            void EncodeErrorInfo( UINT32 &             rErrorInfo, 
-                                  DataRamMemoryBanks   memoryBank, 
-                                  UINT32               offsetFromBankStart, 
-                                  UINT32               failurePattern );
+            void EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 regionNumber );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: IsTestEngineDataInBlock
+            ///
+            /// @par Full Description
+            ///      Determines if a block of words holds data the test engine uses while the block is saved, its own 
+            ///      object, the test patterns, the march tables, or the stack it runs on.  Such a block can not be 
+            ///      marched or block tested.
+            ///
+            /// @param        pFirstWord    First word of the block.
+            ///               nmbrWords     Number of words in the block.
+            ///                               
+            /// @return       TRUE when the block can not be marched or block tested
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsTestEngineDataInBlock( UINT32 * pFirstWord, UINT32 nmbrWords );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: RunMarchElements
+            ///
+            /// @par Full Description
+            ///      Runs the elements of a march algorithm over a block of words with one data background.
+            ///
+            /// @param        pElements       March elements of the algorithm.
+            ///               nmbrElements    Number of march elements.
+            ///               pFirstWord      First word of the block.
+            ///               nmbrWords       Number of words in the block.
+            ///               background      Data background the 0 of the march operations stands for.
+            ///               rFault          Upon failure the word, the values and the element and operation.
+            ///               pBitsInError    NULL to stop at the first failure.  Otherwise one word per word of the 
+            ///                               block, the bits read back wrong are or'ed in and the march runs to the 
+            ///                               end.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL RunMarchElements( const MarchElement * pElements, 
+                                   UINT32               nmbrElements,
+                                   volatile UINT32 *    pFirstWord, 
+                                   UINT32               nmbrWords, 
+                                   UINT32               background,
+                                   DataRamFaultRecord & rFault,
+                                   UINT32 *             pBitsInError );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: RetestFailedWord
+            ///
+            /// @par Full Description
+            ///      Marches the failed word and up to RETEST_NEIGHBOUR_WORDS words on each side of it with March C- 
+            ///      once per re-test data background, with interrupts disabled and the words saved and restored.  Only
+            ///      words of the region between untested ranges are re-tested, and nothing is re-tested when a byte 
+            ///      failed or the words hold data the test engine uses.  The window is small enough that the re-test
+            ///      takes microseconds.
+            ///
+            /// @param        pRamDescriptor  Test information about the region the failure was found in.
+            ///               pFailedAddr     Byte or word where the test failed.
+            ///                               
+            /// @return       None, the result is left in m_LastFaultRetest
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void RetestFailedWord( DataRamTestDescriptor * pRamDescriptor, UINT8 * pFailedAddr );
+                          
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: RecordFault
+            ///
+            /// @par Full Description
+            ///      Adds a failure to the fault record ring and puts it in the user data _OS_Assert copies into the 
+            ///      crash header.  param1 is the failed address, param2 the value expected and param3 the value read 
+            ///      back.
+            ///
+            /// @param        rFault          The failure.
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void RecordFault( const DataRamFaultRecord & rFault );
                           
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagDataRam: RunRamTest
@@ -220,16 +772,104 @@ namespace BlackfinDiagnosticTesting
             ///      Tests an "iternation" amount of RAM.
             ///
             /// @param        pRamDescriptor       Test information about the region being tested.
-            ///               rOffsetFromBankStart Upon failure the offset from the start of the bank where test failed
-            ///               rFailurePattern      The pattern that caused the failure 
+            ///               rFault               Upon failure what failed and how, but for the region and time.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL RunRamTest( DataRamTestDescriptor * pRamDescriptor, DataRamFaultRecord & rFault );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: ReverseBits
+            ///
+            /// @par Full Description
+            ///      Reverses the order of the low bits of a value.
+            ///
+            /// @param        value           Value to reverse the bits of.
+            ///               nmbrBits        Number of low bits reversed.
+            ///                               
+            /// @return       The low bits of the value in reverse order
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 ReverseBits( UINT32 value, UINT32 nmbrBits );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: SelectNextChunk
+            ///
+            /// @par Full Description
+            ///      Selects the chunk of a region tested by the next iteration from the chunk order of the region.  
+            ///      The selection only depends on the progress kept in the descriptor so testing resumes where it 
+            ///      left off.
+            ///
+            /// @param        pRamDescriptor  Test information about the region being tested.
+            ///               rpChunkStart    Set to the first byte of the chunk.
+            ///               rpChunkEnd      Set to the byte after the last byte of the chunk.
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void SelectNextChunk( DataRamTestDescriptor * pRamDescriptor, 
+	                              UINT8 * &               rpChunkStart, 
+	                              UINT8 * &               rpChunkEnd );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestBlock
+            ///
+            /// @par Full Description
+            ///      Tests a range of words of RAM holding live data a save buffer full at a time.  With interrupts 
+            ///      disabled the block is saved, each test pattern is written over the whole block and read back, 
+            ///      and the block is restored.  Blocks holding data the test engine uses are tested one word at a time 
+            ///      with the test patterns instead.
+            ///
+            /// @param        useMdma         TRUE to save and restore the block with memory DMA.
+            ///               flushCacheLines TRUE to flush and invalidate the block from the data cache before the 
+            ///                               save, before each read back and before the restore.
+            ///               pFirstWord      First word to test.
+            ///               nmbrWords       Number of words to test.
+            ///               rFault          Upon failure the word, the values and the pattern number.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestBlock( BOOL                 useMdma,
+	                        BOOL                 flushCacheLines,
+	                        UINT32 *             pFirstWord, 
+	                        UINT32               nmbrWords, 
+	                        DataRamFaultRecord & rFault );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestBytes
+            ///
+            /// @par Full Description
+            ///      Tests a range of RAM one byte at a time
+            ///
+            /// @param        pFirstByte      First byte to test.
+            ///               pEndOfBytes     Byte after the last byte to test.
+            ///               rFault          Upon failure the byte, the values and the pattern number.
             ///                               
             /// @return       TRUE when test passes
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-	        BOOL RunRamTest( DataRamTestDescriptor * pRamDescriptor, 
-                             UINT32 &                rOffsetFromBankStart, 
-                             UINT32 &                rFailurePattern );
+	        BOOL TestBytes( UINT8 *              pFirstByte, 
+	                        UINT8 *              pEndOfBytes, 
+	                        DataRamFaultRecord & rFault );
                       
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: UpdateCriticalSectionCost
+            ///
+            /// @par Full Description
+            ///      Keeps the most cycles measured for a window of one word, and the most cycles per word measured 
+            ///      for the words of a larger window past the first, for a kind of critical section.
+            ///
+            /// @param        rCost           Cost measured so far, updated.
+            ///               cycles          Length of the critical section just measured.
+            ///               nmbrWords       Words tested in the critical section.
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void UpdateCriticalSectionCost( CriticalSectionCost & rCost, UINT32 cycles, UINT32 nmbrWords );
+                          
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagDataRam: TestAByte
             ///
@@ -242,6 +882,97 @@ namespace BlackfinDiagnosticTesting
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 	        BOOL TestAByte(ByteTestParameters * pbtp);
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestMarch
+            ///
+            /// @par Full Description
+            ///      Tests a range of words of RAM with a march algorithm.  The words are marched a save buffer full at
+            ///      a time with interrupts disabled and restored afterwards.  Blocks holding data the march engine 
+            ///      uses are tested one word at a time with the test patterns instead.
+            ///
+            /// @param        testMode        March algorithm to run.
+            ///               pFirstWord      First word to test.
+            ///               nmbrWords       Number of words to test.
+            ///               rFault          Upon failure the word, the values and the step of the march.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestMarch( DataRamTestModes     testMode,
+	                        UINT32 *             pFirstWord, 
+	                        UINT32               nmbrWords, 
+	                        DataRamFaultRecord & rFault );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestRange
+            ///
+            /// @par Full Description
+            ///      Tests a range of RAM with a test mode.  The whole words are tested with the test mode and the 
+            ///      bytes before the first word boundary and after the last one a byte at a time.
+            ///
+            /// @param        testMode        How the whole words are tested.
+            ///               flushCacheLines TRUE to flush and invalidate blocks from the data cache, block modes only.
+            ///               pTestStartAddr  First byte to test.
+            ///               pTestEndAddr    Byte after the last byte to test.
+            ///               rFault          Upon failure the byte or word, the values and the step of the test.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestRange( DataRamTestModes     testMode,
+	                        BOOL                 flushCacheLines,
+	                        UINT8 *              pTestStartAddr, 
+	                        UINT8 *              pTestEndAddr, 
+	                        DataRamFaultRecord & rFault );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestWords
+            ///
+            /// @par Full Description
+            ///      Tests a block of 32 bit words of RAM with interrupts disabled
+            ///
+            /// @param        pwtp              Test information required for testing the words of RAM.
+            ///               generatePatterns  TRUE to test with the standard pattern family built in registers 
+            ///                                 instead of the pattern table.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestWords( WordsTestParameters * pwtp, BOOL generatePatterns );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: TestWordsWithPatterns
+            ///
+            /// @par Full Description
+            ///      Tests a range of words of RAM one word at a time with the test patterns.  The words may hold the
+            ///      test pattern table itself, which would be overwritten by the patterns read from it, so its words
+            ///      are tested with the standard pattern family built in registers instead.
+            ///
+            /// @param        pFirstWord      First word to test.
+            ///               nmbrWords       Number of words to test.
+            ///               rFault          Upon failure the word and the values.
+            ///                               
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestWordsWithPatterns( UINT32 *             pFirstWord, 
+	                                    UINT32               nmbrWords, 
+	                                    DataRamFaultRecord & rFault );
+                      
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRam: FindPatternNumber
+            ///
+            /// @par Full Description
+            ///      Finds the number of a pattern in the pattern table.
+            ///
+            /// @param        pattern         Pattern that failed.
+            ///               patternMask     All ones for a word, the low byte for a byte.
+            ///                               
+            /// @return       Number of the first pattern of the table that matches, DATA_RAM_FAULT_NO_STEP if none
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 FindPatternNumber( UINT32 pattern, UINT32 patternMask );
     };
 };
 
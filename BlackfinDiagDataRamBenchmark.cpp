@@ -0,0 +1,571 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagDataRamBenchmark.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagDataRamBenchmark class.
+///
+/// @see BlackfinDiagDataRamBenchmark.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+
+// SYSTEM INCLUDES
+#include <time.h>
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Hw.h"                  // _GET_CYCLE_COUNT
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagDataRamBenchmark.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+	// Linkage to the reference versions of the word kernels.
+	extern "C" BOOL TestWordsOfRam( BlackfinDiagDataRam::WordsTestParameters * pwtp );
+
+	extern "C" BOOL TestWordsOfRamGeneratedPatterns( BlackfinDiagDataRam::WordsTestParameters * pwtp );
+
+	extern "C" BOOL TestAByteOfRam( BlackfinDiagDataRam::ByteTestParameters * pbtp );
+
+    // Multiplier and increment of the linear congruential generator choosing the faults.
+    static const UINT32 FAULT_LCG_MULTIPLIER = 1103515245;
+    static const UINT32 FAULT_LCG_INCREMENT  = 12345;
+    static const UINT32 FAULT_BITS_PER_WORD  = 32;
+
+    // The simulated RAM before a fault free pass, to check the test restores it.
+    static UINT32 s_LiveData[ RAM_SIMULATOR_WORDS ];
+
+    // The patterns TestWordsOfRamGeneratedPatterns builds, in the order it builds them.
+    static const UINT32 GENERATED_ALL_ONES     = 0xffffffff;
+    static const UINT32 GENERATED_CHECKERBOARD = 0x55555555;
+    static const UINT32 GENERATED_BITS_PER_WORD = 32;
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: Run
+    ///
+    ///      Benchmarks a test mode
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::Run( BlackfinDiagDataRam::DataRamTestModes testMode,
+                                            UINT32                                nmbrTrialsPerFaultModel,
+                                            UINT32                                seed,
+                                            BenchmarkResults &                    rResults )
+    {
+        RunVariant( BENCHMARK_RUNTIME_CONFIGURED, testMode, nmbrTrialsPerFaultModel, seed, rResults );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: CompareVariants
+    ///
+    ///      Benchmarks a test mode with the runtime configured test and with the specialised one
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::CompareVariants( BlackfinDiagDataRam::DataRamTestModes testMode,
+                                                        UINT32                                nmbrTrialsPerFaultModel,
+                                                        UINT32                                seed,
+                                                        VariantComparison &                   rComparison )
+    {
+        UINT32         testPatterns[ BenchmarkTestPatterns::NMBR_TEST_PATTERNS ];
+
+        const UINT32 * pTestPatterns               = m_pTestPatternsRAM;
+
+        UINT32         nmbrTestPatterns            = m_NmbrTestPatterns;
+
+        UINT32         nmbrBytesToTestPerIteration = m_NmbrBytesToTestPerIteration;
+
+        BenchmarkTestPatterns::Fill( testPatterns );
+
+        // The runtime configured test is given what the specialised one has built in.
+        m_pTestPatternsRAM            = testPatterns;
+        m_NmbrTestPatterns            = BenchmarkTestPatterns::NMBR_TEST_PATTERNS;
+        m_NmbrBytesToTestPerIteration = BENCHMARK_SPECIALISED_BYTES_PER_ITERATION;
+
+        RunVariant( BENCHMARK_RUNTIME_CONFIGURED, testMode, nmbrTrialsPerFaultModel, seed, rComparison.m_RuntimeConfigured );
+
+        RunVariant( BENCHMARK_SPECIALISED, testMode, nmbrTrialsPerFaultModel, seed, rComparison.m_Specialised );
+
+        m_pTestPatternsRAM            = pTestPatterns;
+        m_NmbrTestPatterns            = nmbrTestPatterns;
+        m_NmbrBytesToTestPerIteration = nmbrBytesToTestPerIteration;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: ComparePatternKernels
+    ///
+    ///      Times the table pattern kernel and the generated pattern kernel with the same patterns
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::ComparePatternKernels( UINT32                    nmbrPasses,
+                                                              UINT32                    seed,
+                                                              PatternKernelComparison & rComparison )
+    {
+        UINT32 generatedPatterns[ NMBR_GENERATED_PATTERNS ];
+
+        UINT32 nmbrPatterns = 0;
+
+        generatedPatterns[ nmbrPatterns++ ] = GENERATED_ALL_ONES;
+        generatedPatterns[ nmbrPatterns++ ] = ~GENERATED_ALL_ONES;
+        generatedPatterns[ nmbrPatterns++ ] = GENERATED_CHECKERBOARD;
+        generatedPatterns[ nmbrPatterns++ ] = ~GENERATED_CHECKERBOARD;
+
+        for ( UINT32 walkingOne = 1, bit = 0; bit < GENERATED_BITS_PER_WORD; walkingOne <<= 1, ++bit )
+        {
+            generatedPatterns[ nmbrPatterns++ ] = walkingOne;
+            generatedPatterns[ nmbrPatterns++ ] = ~walkingOne;
+        }
+
+        RunKernel( BENCHMARK_TABLE_PATTERN_KERNEL, 
+                   generatedPatterns, 
+                   nmbrPatterns, 
+                   nmbrPasses, 
+                   seed, 
+                   rComparison.m_TablePatterns );
+
+        RunKernel( BENCHMARK_GENERATED_PATTERN_KERNEL, 
+                   NULL, 
+                   NMBR_GENERATED_PATTERNS, 
+                   nmbrPasses, 
+                   seed, 
+                   rComparison.m_GeneratedPatterns );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: CompareByteAndWordKernels
+    ///
+    ///      Times the byte kernel and the table pattern kernel with the benchmark's patterns
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::CompareByteAndWordKernels( UINT32                 nmbrPasses,
+                                                                  UINT32                 seed,
+                                                                  ByteKernelComparison & rComparison )
+    {
+        RunKernel( BENCHMARK_BYTE_KERNEL, 
+                   m_pTestPatternsRAM, 
+                   m_NmbrTestPatterns, 
+                   nmbrPasses, 
+                   seed, 
+                   rComparison.m_Bytes );
+
+        RunKernel( BENCHMARK_TABLE_PATTERN_KERNEL, 
+                   m_pTestPatternsRAM, 
+                   m_NmbrTestPatterns, 
+                   nmbrPasses, 
+                   seed, 
+                   rComparison.m_Words );
+    }
+
+    //***************************************************************************
+    // PRIVATE METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunVariant
+    ///
+    ///      Benchmarks a test mode with one of the data RAM tests
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::RunVariant( BenchmarkVariants                     variant,
+                                                   BlackfinDiagDataRam::DataRamTestModes testMode,
+                                                   UINT32                                nmbrTrialsPerFaultModel,
+                                                   UINT32                                seed,
+                                                   BenchmarkResults &                    rResults )
+    {
+        UINT32 random = seed;
+
+        rResults.m_NmbrFalseErrors           = 0;
+        rResults.m_NmbrLiveDataCorruptions   = 0;
+        rResults.m_NmbrBytesTested           = 0;
+        rResults.m_Microseconds              = 0;
+        rResults.m_BytesPerSecond            = 0;
+        rResults.m_NmbrCycles                = 0;
+        rResults.m_HundredthsOfCyclesPerByte = 0;
+
+        //
+        // Fault free passes for the throughput, and to see the test neither reports errors nor changes the data.
+        //
+        for ( UINT32 trial = 0; trial < nmbrTrialsPerFaultModel; ++trial )
+        {
+            m_rSimulator.Fill( NextRandom( random ) );
+
+            const UINT32 * pMemory = reinterpret_cast<const UINT32 *>( m_rSimulator.GetMemoryStart() );
+
+            for ( UINT32 ui = 0; ui < RAM_SIMULATOR_WORDS; ++ui )
+            {
+                s_LiveData[ ui ] = pMemory[ ui ];
+            }
+
+            BOOL    faultRepeated = FALSE;
+
+            UINT64  startCycles   = 0;
+
+            UINT64  endCycles     = 0;
+
+            clock_t start         = clock();
+
+            _GET_CYCLE_COUNT( startCycles );
+
+            if ( RunTrial( variant, testMode, faultRepeated ) )
+            {
+                ++rResults.m_NmbrFalseErrors;
+            }
+
+            _GET_CYCLE_COUNT( endCycles );
+
+            rResults.m_Microseconds    += ( static_cast<UINT64>( clock() - start ) * BENCHMARK_US_PER_SECOND )
+                                          / CLOCKS_PER_SEC;
+
+            rResults.m_NmbrCycles      += endCycles - startCycles;
+
+            rResults.m_NmbrBytesTested += RAM_SIMULATOR_WORDS * sizeof( UINT32 );
+
+            for ( UINT32 ui = 0; ui < RAM_SIMULATOR_WORDS; ++ui )
+            {
+                if ( s_LiveData[ ui ] != pMemory[ ui ] )
+                {
+                    ++rResults.m_NmbrLiveDataCorruptions;
+
+                    break;
+                }
+            }
+        }
+
+        if ( rResults.m_Microseconds > 0 )
+        {
+            rResults.m_BytesPerSecond = ( rResults.m_NmbrBytesTested * BENCHMARK_US_PER_SECOND ) / rResults.m_Microseconds;
+        }
+
+        if ( rResults.m_NmbrBytesTested > 0 )
+        {
+            rResults.m_HundredthsOfCyclesPerByte = static_cast<UINT32>( ( rResults.m_NmbrCycles * BENCHMARK_HUNDREDTHS ) 
+                                                                        / rResults.m_NmbrBytesTested );
+        }
+
+        //
+        // A fault injected per trial for each of the fault models.
+        //
+        for ( UINT32 model = 0; model < BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS; ++model )
+        {
+            BlackfinDiagRamSimulator::RamFaultModels faultModel = static_cast<BlackfinDiagRamSimulator::RamFaultModels>( model );
+
+            rResults.m_NmbrFaultsInjected[ model ]   = 0;
+            rResults.m_NmbrFaultsDetected[ model ]   = 0;
+            rResults.m_DetectionRatePercent[ model ] = 0;
+            rResults.m_NmbrFaultsRepeated[ model ]   = 0;
+
+            for ( UINT32 trial = 0; trial < nmbrTrialsPerFaultModel; ++trial )
+            {
+                BlackfinDiagRamSimulator::RamFault fault;
+
+                m_rSimulator.Fill( NextRandom( random ) );
+
+                ChooseFault( faultModel, random, fault );
+
+                if ( !m_rSimulator.InjectFault( fault ) )
+                {
+                    continue;
+                }
+
+                ++rResults.m_NmbrFaultsInjected[ model ];
+
+                BOOL faultRepeated = FALSE;
+
+                if ( RunTrial( variant, testMode, faultRepeated ) )
+                {
+                    ++rResults.m_NmbrFaultsDetected[ model ];
+                }
+
+                if ( faultRepeated )
+                {
+                    ++rResults.m_NmbrFaultsRepeated[ model ];
+                }
+            }
+
+            if ( rResults.m_NmbrFaultsInjected[ model ] > 0 )
+            {
+                rResults.m_DetectionRatePercent[ model ] = ( rResults.m_NmbrFaultsDetected[ model ] * BENCHMARK_PERCENT )
+                                                           / rResults.m_NmbrFaultsInjected[ model ];
+            }
+        }
+
+        m_rSimulator.ClearFaults();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunTrial
+    ///
+    ///      Runs the data RAM test over the simulated RAM for one diagnostic cycle, or until an error is reported
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagDataRamBenchmark::RunTrial( BenchmarkVariants                     variant,
+                                                 BlackfinDiagDataRam::DataRamTestModes testMode,
+                                                 BOOL &                                rFaultRepeated )
+    {
+        BlackfinDiagDataRam::DataRamTestDescriptor regions[ BENCHMARK_NMBR_REGIONS ] =
+                                                   {
+                                                       {
+                                                           m_rSimulator.GetMemoryStart(),
+                                                           RAM_SIMULATOR_WORDS * sizeof( UINT32 ),
+                                                           0,
+                                                           FALSE,
+                                                           testMode,
+                                                           BlackfinDiagDataRam::DATA_RAM_ASCENDING_CHUNKS,
+                                                           FALSE,
+                                                           0
+                                                       }
+                                                   };
+
+        // Timestamps, durations and counts as the runtime starts them, no pause, batching or prerequisites.
+        DiagnosticTesting::DiagnosticTest::ExecuteTestData execTestData =
+                                                   {
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       1,
+                                                       0,
+                                                       DiagnosticTesting::DiagnosticTest::DIAG_DATA_RAM_TEST_TYPE,
+                                                       DiagnosticTesting::DiagnosticTest::TEST_IDLE,
+                                                       FALSE,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       1,
+                                                       0
+                                                   };
+
+        BlackfinDiagDataRam    runtimeConfiguredTest( regions,
+                                                      BENCHMARK_NMBR_REGIONS,
+                                                      NULL,
+                                                      0,
+                                                      m_pTestPatternsRAM,
+                                                      m_NmbrTestPatterns,
+                                                      m_NmbrBytesToTestPerIteration,
+                                                      0,
+                                                      execTestData );
+
+        SpecialisedDataRamTest specialisedTest( regions, NULL, 0, 0, execTestData );
+
+        BlackfinDiagDataRam &  dataRamTest = ( BENCHMARK_SPECIALISED == variant ) 
+                                             ? static_cast<BlackfinDiagDataRam &>( specialisedTest ) 
+                                             : runtimeConfiguredTest;
+
+        BOOL errorReported = FALSE;
+
+        m_rSimulator.Activate();
+
+        for ( UINT32 ui = 0; ui < BENCHMARK_MAX_ITERATIONS_PER_TRIAL; ++ui )
+        {
+            UINT32 errorCode = 0;
+
+            DiagnosticTesting::DiagnosticTest::TestState ts = dataRamTest.RunTest( errorCode );
+
+            if ( 0 != errorCode )
+            {
+                BlackfinDiagDataRam::FaultRetestResult retest;
+
+                dataRamTest.GetLastFaultRetest( retest );
+
+                rFaultRepeated = ( retest.m_NmbrRepeats > 0 );
+
+                errorReported  = TRUE;
+
+                break;
+            }
+
+            if ( DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE == ts )
+            {
+                break;
+            }
+
+            // As the scheduler does between iterations, so the next one does not start a new diagnostic cycle.
+            dataRamTest.SetCurrentTestState( ts );
+        }
+
+        m_rSimulator.Deactivate();
+
+        return errorReported;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunKernel
+    ///
+    ///      Times a kernel over the whole of the simulated RAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::RunKernel( BenchmarkKernels kernel,
+                                                  const UINT32 *   pTestPatterns,
+                                                  UINT32           nmbrPatterns,
+                                                  UINT32           nmbrPasses,
+                                                  UINT32           seed,
+                                                  KernelResults &  rResults )
+    {
+        UINT32 random = seed;
+
+        rResults.m_NmbrFalseErrors           = 0;
+        rResults.m_NmbrTestPatterns          = nmbrPatterns;
+        rResults.m_NmbrBytesTested           = 0;
+        rResults.m_Microseconds              = 0;
+        rResults.m_BytesPerSecond            = 0;
+        rResults.m_NmbrCycles                = 0;
+        rResults.m_HundredthsOfCyclesPerByte = 0;
+
+        m_rSimulator.Fill( NextRandom( random ) );
+
+        BlackfinDiagDataRam::WordsTestParameters wtp;
+
+        UINT64  startCycles = 0;
+
+        UINT64  endCycles   = 0;
+
+        clock_t start       = clock();
+
+        _GET_CYCLE_COUNT( startCycles );
+
+        for ( UINT32 pass = 0; pass < nmbrPasses; ++pass )
+        {
+            if ( BENCHMARK_BYTE_KERNEL == kernel )
+            {
+                rResults.m_NmbrFalseErrors += RunByteKernel( pTestPatterns, nmbrPatterns );
+
+                continue;
+            }
+
+            wtp.m_pWordsToTest     = reinterpret_cast<UINT32 *>( m_rSimulator.GetMemoryStart() );
+            wtp.m_NmbrWordsToTest  = RAM_SIMULATOR_WORDS;
+            wtp.m_pTestPatterns    = pTestPatterns;
+            wtp.m_NmbrTestPatterns = nmbrPatterns;
+
+            BOOL testPassed = ( BENCHMARK_GENERATED_PATTERN_KERNEL == kernel ) ? TestWordsOfRamGeneratedPatterns( &wtp ) 
+                                                                               : TestWordsOfRam( &wtp );
+
+            if ( !testPassed )
+            {
+                ++rResults.m_NmbrFalseErrors;
+            }
+        }
+
+        _GET_CYCLE_COUNT( endCycles );
+
+        rResults.m_Microseconds    = ( static_cast<UINT64>( clock() - start ) * BENCHMARK_US_PER_SECOND ) / CLOCKS_PER_SEC;
+
+        rResults.m_NmbrCycles      = endCycles - startCycles;
+
+        rResults.m_NmbrBytesTested = static_cast<UINT64>( RAM_SIMULATOR_WORDS * sizeof( UINT32 ) ) * nmbrPasses;
+
+        if ( rResults.m_Microseconds > 0 )
+        {
+            rResults.m_BytesPerSecond = ( rResults.m_NmbrBytesTested * BENCHMARK_US_PER_SECOND ) / rResults.m_Microseconds;
+        }
+
+        if ( rResults.m_NmbrBytesTested > 0 )
+        {
+            rResults.m_HundredthsOfCyclesPerByte = static_cast<UINT32>( ( rResults.m_NmbrCycles * BENCHMARK_HUNDREDTHS ) 
+                                                                        / rResults.m_NmbrBytesTested );
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunByteKernel
+    ///
+    ///      Tests each byte of the simulated RAM with the byte kernel, once per byte
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRamBenchmark::RunByteKernel( const UINT32 * pTestPatterns, UINT32 nmbrPatterns )
+    {
+        UINT32 nmbrFalseErrors = 0;
+
+        UINT8  patternThatFailed = 0;
+
+        UINT8  valueReadBack     = 0;
+
+        UINT8 * pByteToTest      = m_rSimulator.GetMemoryStart();
+
+        for ( UINT32 ui = 0; ui < ( RAM_SIMULATOR_WORDS * sizeof( UINT32 ) ); ++ui )
+        {
+            BlackfinDiagDataRam::ByteTestParameters btp;
+
+            btp.m_pByteToTest        = pByteToTest++;
+            btp.m_pPatternThatFailed = &patternThatFailed;
+            btp.m_pTestPatterns      = pTestPatterns;
+            btp.m_NmbrTestPatterns   = nmbrPatterns;
+            btp.m_pValueReadBack     = &valueReadBack;
+
+            if ( !TestAByteOfRam( &btp ) )
+            {
+                ++nmbrFalseErrors;
+            }
+        }
+
+        return nmbrFalseErrors;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: ChooseFault
+    ///
+    ///      Chooses a fault of a model at a pseudo random word and bit of the simulated RAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagDataRamBenchmark::ChooseFault( BlackfinDiagRamSimulator::RamFaultModels faultModel,
+                                                    UINT32 &                                 rRandom,
+                                                    BlackfinDiagRamSimulator::RamFault &     rFault )
+    {
+        rFault.m_FaultModel       = faultModel;
+        rFault.m_VictimWord       = NextRandom( rRandom ) % RAM_SIMULATOR_WORDS;
+        rFault.m_VictimBitMask    = 1 << ( NextRandom( rRandom ) % FAULT_BITS_PER_WORD );
+        rFault.m_FaultValue       = ( NextRandom( rRandom ) & 1 ) ? rFault.m_VictimBitMask : 0;
+        rFault.m_AggressorBitMask = 1 << ( NextRandom( rRandom ) % FAULT_BITS_PER_WORD );
+
+        //
+        // The aggressor is some other word of the block the victim is tested in.  The benchmark does not bound the
+        // critical sections, so the blocks are the save buffer, or the iteration when that is smaller, from the start
+        // of the simulated RAM.  The block tests and the marches only cover faults between words of the same block.
+        //
+        UINT32 nmbrBlockWords     = m_NmbrBytesToTestPerIteration / sizeof( UINT32 );
+
+        if ( nmbrBlockWords > SAVE_BUFFER_WORDS )
+        {
+            nmbrBlockWords = SAVE_BUFFER_WORDS;
+        }
+
+        UINT32 firstBlockWord     = rFault.m_VictimWord - ( rFault.m_VictimWord % nmbrBlockWords );
+
+        rFault.m_AggressorWord    = firstBlockWord
+                                    + ( ( ( rFault.m_VictimWord - firstBlockWord ) + 1 + ( NextRandom( rRandom ) % ( nmbrBlockWords - 1 ) ) )
+                                        % nmbrBlockWords );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagDataRamBenchmark: NextRandom
+    ///
+    ///      Advances the pseudo random state
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagDataRamBenchmark::NextRandom( UINT32 & rRandom )
+    {
+        rRandom = ( rRandom * FAULT_LCG_MULTIPLIER ) + FAULT_LCG_INCREMENT;
+
+        // The low bits of the generator are not very random.
+        return rRandom >> 8;
+    }
+
+}
+
+#endif // defined(BLACKFIN_DIAG_HOST_BUILD)
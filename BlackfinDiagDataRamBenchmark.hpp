@@ -0,0 +1,390 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagDataRamBenchmark.hpp
+///
+/// Namespace for the Linux host benchmark of the data RAM test
+///
+/// @par Full Description
+///
+/// Only built with BLACKFIN_DIAG_HOST_BUILD defined, along with BlackfinDiagRamSimulator.cpp and
+/// BlackfinDataRamTestReference.cpp in place of the assembly language.  For a test mode the benchmark runs the data
+/// RAM test over the simulated RAM the way the scheduler does, an iteration at a time until a diagnostic cycle
+/// completes or an error is reported.  It is run first with no faults to measure the bytes tested per second and
+/// check for false errors, then once per trial for each fault model with a fault injected at a pseudo random word
+/// and bit to measure the rate faults are detected.  A coupling fault's aggressor is put in the victim's block, since
+/// the test only covers coupling within a block.  Of the faults detected it counts those the re-test of the words
+/// around the failed word found again.  The host's _OS_Assert has to return for errors to be counted, and the host has 
+/// to define user_crash_data.  The fault free passes are also timed with _GET_CYCLE_COUNT for the cycles per byte, the
+/// host's Hw.h has to read a cycle counter for it.  A test mode can be compared between the runtime configured test 
+/// and BlackfinDiagDataRamSpecialised, both run with the same patterns and bytes per iteration.
+///
+/// The word kernels can also be timed on their own over the whole of the simulated RAM, without the test around
+/// them.  The table kernel is given the patterns the generated pattern kernel builds in registers, in the same order,
+/// so the two do the same writes and reads and differ only in where the patterns come from.  The byte kernel the test
+/// ran before the word kernels is timed the way it was called, once per byte, against the table kernel with the
+/// benchmark's patterns.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_DATA_RAM_BENCHMARK_HPP)
+#define BLACKFIN_DIAG_DATA_RAM_BENCHMARK_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagDataRam.hpp"
+#include "BlackfinDiagDataRamSpecialised.hpp"
+#include "BlackfinDiagRamSimulator.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 BENCHMARK_MAX_ITERATIONS_PER_TRIAL = 0x10000;   // So a test that never completes can't hang
+    static const UINT32 BENCHMARK_PERCENT                  = 100;
+    static const UINT32 BENCHMARK_US_PER_SECOND            = 1000000;
+    static const UINT32 BENCHMARK_HUNDREDTHS               = 100;
+    static const UINT32 BENCHMARK_NMBR_REGIONS             = 1;       // The whole of the simulated RAM
+    static const UINT32 BENCHMARK_SPECIALISED_BYTES_PER_ITERATION = 0x400;
+
+    // Patterns of the variant comparison.
+    typedef DataRamPatternList< 0xffffffff,
+            DataRamPatternList< 0xaaaaaaaa,
+            DataRamPatternList< 0x55555555,
+            DataRamPatternList< 0,
+            DataRamPatternList< 0xcccccccc,
+            DataRamPatternList< 0x33333333,
+            DataRamPatternList< 0xf0f0f0f0,
+            DataRamPatternList< 0x0f0f0f0f,
+            DataRamPatternListEnd > > > > > > > > BenchmarkTestPatterns;
+
+    class BlackfinDiagDataRamBenchmark
+    {
+        public:
+
+            // Results of benchmarking a test mode.
+            typedef struct
+            {
+                UINT32           m_NmbrFaultsInjected[ BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS ];
+                UINT32           m_NmbrFaultsDetected[ BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS ];
+                UINT32           m_DetectionRatePercent[ BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS ];
+                UINT32           m_NmbrFaultsRepeated[ BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS ]; // By the re-test
+                UINT32           m_NmbrFalseErrors;          // Errors reported without a fault injected
+                UINT32           m_NmbrLiveDataCorruptions;  // Fault free passes that did not restore the data
+                UINT64           m_NmbrBytesTested;          // By the fault free passes
+                UINT64           m_Microseconds;             // Taken by the fault free passes
+                UINT64           m_BytesPerSecond;
+                UINT64           m_NmbrCycles;               // Taken by the fault free passes
+                UINT32           m_HundredthsOfCyclesPerByte;
+            }
+            BenchmarkResults;
+
+            // The data RAM test with its configuration fixed at compile time, as compared.
+            typedef BlackfinDiagDataRamSpecialised< BenchmarkTestPatterns,
+                                                    BENCHMARK_SPECIALISED_BYTES_PER_ITERATION,
+                                                    BENCHMARK_NMBR_REGIONS > SpecialisedDataRamTest;
+
+            // Which data RAM test is run.
+            typedef enum
+            {
+                BENCHMARK_RUNTIME_CONFIGURED = 0,   // BlackfinDiagDataRam
+                BENCHMARK_SPECIALISED               // SpecialisedDataRamTest
+            }
+            BenchmarkVariants;
+
+            // Results of comparing the variants for a test mode.
+            typedef struct
+            {
+                BenchmarkResults m_RuntimeConfigured;
+                BenchmarkResults m_Specialised;
+            }
+            VariantComparison;
+
+            // Results of timing a kernel on its own.
+            typedef struct
+            {
+                UINT32           m_NmbrFalseErrors;          // Failures reported over the fault free RAM
+                UINT32           m_NmbrTestPatterns;         // Written and read back per word
+                UINT64           m_NmbrBytesTested;
+                UINT64           m_Microseconds;
+                UINT64           m_BytesPerSecond;
+                UINT64           m_NmbrCycles;
+                UINT32           m_HundredthsOfCyclesPerByte;
+            }
+            KernelResults;
+
+            // Which kernel is timed.
+            typedef enum
+            {
+                BENCHMARK_TABLE_PATTERN_KERNEL = 0, // TestWordsOfRam
+                BENCHMARK_GENERATED_PATTERN_KERNEL, // TestWordsOfRamGeneratedPatterns
+                BENCHMARK_BYTE_KERNEL               // TestAByteOfRam, called once per byte
+            }
+            BenchmarkKernels;
+
+            // Results of comparing the table and generated pattern kernels.
+            typedef struct
+            {
+                KernelResults    m_TablePatterns;
+                KernelResults    m_GeneratedPatterns;
+            }
+            PatternKernelComparison;
+
+            // Results of comparing the byte and word kernels.
+            typedef struct
+            {
+                KernelResults    m_Bytes;
+                KernelResults    m_Words;
+            }
+            ByteKernelComparison;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: BlackfinDiagDataRamBenchmark
+            ///
+            /// @par Full Description
+            ///      Construction of a benchmark of the data RAM test over a simulated RAM.
+            ///
+            ///
+            /// @param rSimulator                   Simulated RAM tested, not on the stack, the whole of it is one region.
+            ///        pTestPatternsForRamTesting   Test patterns passed to the data RAM test.
+            ///        nmbrRamTestingPatterns       Size of the array of test patterns.
+            ///        nmbrBytesToTestPerIteration  Number of bytes of RAM per iteration of the test.
+            ///
+            /// @return                             Benchmark instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagDataRamBenchmark( BlackfinDiagRamSimulator & rSimulator,
+	                                      const UINT32 *             pTestPatternsForRamTesting,
+	                                      UINT32                     nmbrRamTestingPatterns,
+	                                      UINT32                     nmbrBytesToTestPerIteration )
+	                               :    m_rSimulator                      ( rSimulator ),
+	                                    m_pTestPatternsRAM                ( pTestPatternsForRamTesting ),
+	                                    m_NmbrTestPatterns                ( nmbrRamTestingPatterns ),
+	                                    m_NmbrBytesToTestPerIteration     ( nmbrBytesToTestPerIteration )
+	        {
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: Run
+            ///
+            /// @par Full Description
+            ///      Benchmarks a test mode.  The same seed gives the same faults.
+            ///
+            ///
+            /// @param testMode                     Test mode benchmarked.
+            ///        nmbrTrialsPerFaultModel      Fault free passes run, and faults injected of each model.
+            ///        seed                         Seed of the pseudo random data and fault locations.
+            ///        rResults                     Filled in with the results.
+            ///
+            /// @return                             None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void Run( BlackfinDiagDataRam::DataRamTestModes testMode,
+	                  UINT32                                nmbrTrialsPerFaultModel,
+	                  UINT32                                seed,
+	                  BenchmarkResults &                    rResults );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: CompareVariants
+            ///
+            /// @par Full Description
+            ///      Benchmarks a test mode with the runtime configured test and with SpecialisedDataRamTest.  Both are
+            ///      run with BenchmarkTestPatterns and BENCHMARK_SPECIALISED_BYTES_PER_ITERATION, not the patterns and
+            ///      bytes per iteration the benchmark was constructed with, and the same seed.
+            ///
+            ///
+            /// @param testMode                     Test mode benchmarked.
+            ///        nmbrTrialsPerFaultModel      Fault free passes run, and faults injected of each model.
+            ///        seed                         Seed of the pseudo random data and fault locations.
+            ///        rComparison                  Filled in with the results of each.
+            ///
+            /// @return                             None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void CompareVariants( BlackfinDiagDataRam::DataRamTestModes testMode,
+	                              UINT32                                nmbrTrialsPerFaultModel,
+	                              UINT32                                seed,
+	                              VariantComparison &                   rComparison );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: ComparePatternKernels
+            ///
+            /// @par Full Description
+            ///      Times the table pattern kernel and the generated pattern kernel over the whole of the simulated
+            ///      RAM, the table kernel with the NMBR_GENERATED_PATTERNS patterns the other builds in registers.
+            ///
+            ///
+            /// @param nmbrPasses                   Passes over the simulated RAM timed for each kernel.
+            ///        seed                         Seed of the pseudo random data.
+            ///        rComparison                  Filled in with the results of each.
+            ///
+            /// @return                             None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ComparePatternKernels( UINT32 nmbrPasses, UINT32 seed, PatternKernelComparison & rComparison );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: CompareByteAndWordKernels
+            ///
+            /// @par Full Description
+            ///      Times the byte kernel, called once per byte, and the table pattern kernel over the whole of the
+            ///      simulated RAM, both with the benchmark's patterns.
+            ///
+            ///
+            /// @param nmbrPasses                   Passes over the simulated RAM timed for each kernel.
+            ///        seed                         Seed of the pseudo random data.
+            ///        rComparison                  Filled in with the results of each.
+            ///
+            /// @return                             None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void CompareByteAndWordKernels( UINT32 nmbrPasses, UINT32 seed, ByteKernelComparison & rComparison );
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagDataRamBenchmark(const BlackfinDiagDataRamBenchmark &);
+
+	        const BlackfinDiagDataRamBenchmark & operator = (const BlackfinDiagDataRamBenchmark & );
+
+            BlackfinDiagDataRamBenchmark();
+
+	        BlackfinDiagRamSimulator & m_rSimulator;
+
+	        const UINT32 *             m_pTestPatternsRAM;
+
+	        UINT32                     m_NmbrTestPatterns;
+
+	        UINT32                     m_NmbrBytesToTestPerIteration;
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunVariant
+            ///
+            /// @par Full Description
+            ///      Benchmarks a test mode with one of the data RAM tests.
+            ///
+            /// @param        variant                  Data RAM test run.
+            ///               testMode                 Test mode benchmarked.
+            ///               nmbrTrialsPerFaultModel  Fault free passes run, and faults injected of each model.
+            ///               seed                     Seed of the pseudo random data and fault locations.
+            ///               rResults                 Filled in with the results.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void RunVariant( BenchmarkVariants                     variant,
+	                         BlackfinDiagDataRam::DataRamTestModes testMode,
+	                         UINT32                                nmbrTrialsPerFaultModel,
+	                         UINT32                                seed,
+	                         BenchmarkResults &                    rResults );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunTrial
+            ///
+            /// @par Full Description
+            ///      Runs the data RAM test over the simulated RAM for one diagnostic cycle, or until an error is
+            ///      reported, with the simulator active.
+            ///
+            /// @param        variant        Data RAM test run.
+            ///               testMode       Test mode run.
+            ///               rFaultRepeated Set TRUE when an error was reported and the re-test of the words around 
+            ///                              the failed word found the failure again.
+            ///
+            /// @return       TRUE when an error was reported
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL RunTrial( BenchmarkVariants variant, BlackfinDiagDataRam::DataRamTestModes testMode, BOOL & rFaultRepeated );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunKernel
+            ///
+            /// @par Full Description
+            ///      Times a kernel over the whole of the simulated RAM, filled with pseudo random data, without faults.
+            ///
+            /// @param        kernel         Kernel timed.
+            ///               pTestPatterns  Patterns of the table kernels.
+            ///               nmbrPatterns   Number of patterns, the generated pattern kernel has its own.
+            ///               nmbrPasses     Passes over the simulated RAM timed.
+            ///               seed           Seed of the pseudo random data.
+            ///               rResults       Filled in with the results.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void RunKernel( BenchmarkKernels kernel,
+	                        const UINT32 *   pTestPatterns,
+	                        UINT32           nmbrPatterns,
+	                        UINT32           nmbrPasses,
+	                        UINT32           seed,
+	                        KernelResults &  rResults );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: RunByteKernel
+            ///
+            /// @par Full Description
+            ///      Tests each byte of the simulated RAM with the byte kernel, a call per byte as the test made them.
+            ///
+            /// @param        pTestPatterns  Patterns, the low byte of each is written.
+            ///               nmbrPatterns   Number of patterns.
+            ///
+            /// @return       Number of bytes the kernel reported failed
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 RunByteKernel( const UINT32 * pTestPatterns, UINT32 nmbrPatterns );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: ChooseFault
+            ///
+            /// @par Full Description
+            ///      Chooses a fault of a model at a pseudo random word and bit of the simulated RAM, with any aggressor
+            ///      in the same block as the victim.
+            ///
+            /// @param        faultModel     Model of the fault.
+            ///               rRandom        Pseudo random state, advanced.
+            ///               rFault         Filled in with the fault.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ChooseFault( BlackfinDiagRamSimulator::RamFaultModels faultModel,
+	                          UINT32 &                                 rRandom,
+	                          BlackfinDiagRamSimulator::RamFault &     rFault );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamBenchmark: NextRandom
+            ///
+            /// @par Full Description
+            ///      Advances the pseudo random state.
+            ///
+            /// @param        rRandom        Pseudo random state.
+            ///
+            /// @return       The next pseudo random number
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 NextRandom( UINT32 & rRandom );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_DATA_RAM_BENCHMARK_HPP)
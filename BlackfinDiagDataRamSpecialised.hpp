@@ -0,0 +1,334 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagDataRamSpecialised.hpp
+///
+/// Namespace for the data RAM test with its configuration fixed at compile time
+///
+/// @par Full Description
+///
+/// BlackfinDiagDataRam takes its pattern table, bytes per iteration and region table at run time, so the loops that
+/// write and read back the patterns run the table a pattern at a time with the count in a register.  When a test's
+/// configuration never changes it can be given as template arguments instead.  The pattern set is a list of types,
+/// DataRamPatternList< 0xffffffff, DataRamPatternList< 0, DataRamPatternListEnd > > and so on, and each pattern is
+/// a constant in the code.  The word kernel tests a word with every pattern in straight line code, no loop and one
+/// compare per pattern.  The block kernel runs the same algorithm over the same block as the runtime configured
+/// kernel, each pattern is written over the whole block and then read back, only the pattern is a constant rather
+/// than loaded from the table.  The size of the region table is checked at compile time.  Region bounds come from
+/// the .ldf file so the table itself is still filled in at link time.
+///
+/// Everything else, the chunk order, exclusions, cache ranges, critical section windows, march tests, re-test of a
+/// failure and fault records, is the runtime configured class's.  Blocks flushed from the data cache run the runtime
+/// configured kernel.  The host benchmark has not shown it to be faster than BlackfinDiagDataRam, which remains the
+/// test the runtime environment constructs for every bank.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_DATA_RAM_SPECIALISED_HPP)
+#define BLACKFIN_DIAG_DATA_RAM_SPECIALISED_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagDataRam.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 MAX_SPECIALISED_DATA_RAM_REGIONS = 7;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CLASS NAME: DataRamPatternListEnd
+    ///
+    /// Ends a list of test patterns, the kernels of an empty list pass.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct DataRamPatternListEnd
+    {
+        static const UINT32 NMBR_TEST_PATTERNS = 0;
+
+        static inline void Fill( UINT32 * )
+        {
+        }
+
+        static inline BOOL TestWord( volatile UINT32 *, UINT32, BlackfinDiagDataRam::WordsTestParameters * )
+        {
+            return TRUE;
+        }
+
+        static inline BOOL TestBlock( BlackfinDiagDataRam::WordsTestParameters * )
+        {
+            return TRUE;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CLASS NAME: DataRamPatternList
+    ///
+    /// A test pattern followed by the rest of the list.
+    ///
+    /// @par Full Description
+    ///
+    /// The kernels handle this pattern and then call those of the rest of the list, the compiler expands the calls
+    /// into straight line code for the whole list.  Failures are reported through the same parameter structure members
+    /// as the assembly language routines.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <UINT32 PATTERN, typename NEXT_PATTERNS>
+    struct DataRamPatternList
+    {
+        static const UINT32 NMBR_TEST_PATTERNS = NEXT_PATTERNS::NMBR_TEST_PATTERNS + 1;
+
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ///	METHOD NAME: DataRamPatternList: Fill
+        ///
+        /// @par Full Description
+        ///      Fills in a table with the patterns of the list, for the parts of the test that use the table.
+        ///
+        /// @param        pPatterns         Table of at least NMBR_TEST_PATTERNS words.
+        ///
+        /// @return       None
+        ///
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static inline void Fill( UINT32 * pPatterns )
+        {
+            *pPatterns = PATTERN;
+
+            NEXT_PATTERNS::Fill( pPatterns + 1 );
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ///	METHOD NAME: DataRamPatternList: TestWord
+        ///
+        /// @par Full Description
+        ///      Writes each pattern of the list to a word and reads it back.  The word is restored when a pattern
+        ///      fails, the caller restores it when they all pass.
+        ///
+        /// @param        pWord             Word tested.
+        ///               savedWord         Value of the word before the test.
+        ///               pwtp              Test information, the failure is reported through it.
+        ///
+        /// @return       TRUE when test passes
+        ///
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static inline BOOL TestWord( volatile UINT32 *                          pWord,
+                                     UINT32                                     savedWord,
+                                     BlackfinDiagDataRam::WordsTestParameters * pwtp )
+        {
+            WriteRamWord( pWord, PATTERN );
+
+            UINT32 readBack = ReadRamWord( pWord );
+
+            if ( PATTERN != readBack )
+            {
+                WriteRamWord( pWord, savedWord );
+
+                pwtp->m_pWordThatFailed   = const_cast<UINT32 *>( pWord );
+
+                pwtp->m_PatternThatFailed = PATTERN;
+
+                pwtp->m_ValueReadBack     = readBack;
+
+                return FALSE;
+            }
+
+            return NEXT_PATTERNS::TestWord( pWord, savedWord, pwtp );
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ///	METHOD NAME: DataRamPatternList: TestBlock
+        ///
+        /// @par Full Description
+        ///      Writes each pattern of the list over the whole of a saved block and reads it back, stopping at the
+        ///      first word that reads back wrong, as the runtime configured block kernel does.
+        ///
+        /// @param        pwtp              Test information, the failure is reported through it.
+        ///
+        /// @return       TRUE when test passes
+        ///
+        ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static inline BOOL TestBlock( BlackfinDiagDataRam::WordsTestParameters * pwtp )
+        {
+            volatile UINT32 * pBlock    = pwtp->m_pWordsToTest;
+
+            UINT32            nmbrWords = pwtp->m_NmbrWordsToTest;
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                WriteRamWord( pBlock + ui, PATTERN );
+            }
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                UINT32 readBack = ReadRamWord( pBlock + ui );
+
+                if ( PATTERN != readBack )
+                {
+                    pwtp->m_pWordThatFailed   = pwtp->m_pWordsToTest + ui;
+
+                    pwtp->m_PatternThatFailed = PATTERN;
+
+                    pwtp->m_ValueReadBack     = readBack;
+
+                    return FALSE;
+                }
+            }
+
+            return NEXT_PATTERNS::TestBlock( pwtp );
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CLASS NAME: BlackfinDiagDataRamSpecialised
+    ///
+    /// Template class for a data RAM test with its pattern set, bytes per iteration and number of regions fixed at
+    /// compile time.
+    ///
+    /// @par Full Description
+    ///
+    /// Instantiate with a DataRamPatternList of the patterns, the bytes tested per iteration and the number of regions
+    /// in the region table.  Each pattern is a byte replicated across the word, as for the runtime configured test.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename PATTERNS, UINT32 NMBR_BYTES_PER_ITERATION, UINT32 NMBR_REGIONS>
+    class BlackfinDiagDataRamSpecialised : public BlackfinDiagDataRam
+    {
+        public:
+
+            // Words of a full block, a block is never more than an iteration or the save buffer.
+            static const UINT32 NMBR_BLOCK_WORDS = ( ( NMBR_BYTES_PER_ITERATION / sizeof( UINT32 ) ) < SAVE_BUFFER_WORDS )
+                                                   ? ( NMBR_BYTES_PER_ITERATION / sizeof( UINT32 ) )
+                                                   : SAVE_BUFFER_WORDS;
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamSpecialised: BlackfinDiagDataRamSpecialised
+            ///
+            /// @par Full Description
+            ///      Construction of a data RAM test with its configuration fixed at compile time.
+            ///
+            ///
+            /// @param rDataRamRegions              The Data RAM memory regions to test, tested in order.
+            ///        pExclusionRanges             Array of ranges within the regions that are not tested, NULL for
+            ///                                     none.
+            ///        nmbrExclusionRanges          Number of ranges in the array.
+            ///        maxCriticalSectionCycles     Most cycles interrupts are to be disabled for at a time, 0 for no
+            ///                                     limit.
+            ///        ExecuteTestData              Initial runtime data passed to the base for running this test.
+            ///
+            /// @return                             Blackfin Data Ram diagnostic instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagDataRamSpecialised( DataRamTestDescriptor         (& rDataRamRegions)[ NMBR_REGIONS ],
+	                                        const DataRamExclusionRange * pExclusionRanges,
+	                                        UINT32                        nmbrExclusionRanges,
+	                                        UINT32                        maxCriticalSectionCycles,
+		    		                        DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData )
+						                :  BlackfinDiagDataRam ( rDataRamRegions,
+						                                         NMBR_REGIONS,
+						                                         pExclusionRanges,
+						                                         nmbrExclusionRanges,
+						                                         m_TestPatterns,
+						                                         PATTERNS::NMBR_TEST_PATTERNS,
+						                                         NMBR_BYTES_PER_ITERATION,
+						                                         maxCriticalSectionCycles,
+						                                         rTestData )
+	        {
+	            // Does not compile unless there is at least one pattern and the region number fits the error code.
+	            typedef char ConfigurationCheck[ (    ( PATTERNS::NMBR_TEST_PATTERNS > 0 )
+	                                               && ( NMBR_REGIONS > 0 )
+	                                               && ( NMBR_REGIONS <= MAX_SPECIALISED_DATA_RAM_REGIONS )
+	                                               && ( NMBR_BLOCK_WORDS > 0 ) ) ? 1 : -1 ];
+
+	            (void)sizeof( ConfigurationCheck );
+
+	            PATTERNS::Fill( m_TestPatterns );
+	        }
+
+        protected:
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamSpecialised: RunWordsKernel
+            ///
+            /// @par Full Description
+            ///      Replaces the pattern table loop of the runtime configured test, each word is tested with the
+            ///      patterns of the list in straight line code.
+            ///
+            /// @param        pwtp              Test information required for testing the words of RAM.
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL RunWordsKernel( WordsTestParameters * pwtp )
+	        {
+	            volatile UINT32 * pWord    = pwtp->m_pWordsToTest;
+
+	            volatile UINT32 * pEndWord = pWord + pwtp->m_NmbrWordsToTest;
+
+	            for ( ; pWord < pEndWord; ++pWord )
+	            {
+	                UINT32 savedWord = ReadRamWord( pWord );
+
+	                if ( !PATTERNS::TestWord( pWord, savedWord, pwtp ) )
+	                {
+	                    return FALSE;
+	                }
+
+	                WriteRamWord( pWord, savedWord );
+	            }
+
+	            return TRUE;
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagDataRamSpecialised: RunBlockKernel
+            ///
+            /// @par Full Description
+            ///      Replaces the pattern table loop of the runtime configured test for blocks that are not flushed
+            ///      from the data cache.  The patterns of the list are each written over the whole block and read
+            ///      back.
+            ///
+            /// @param        pwtp              Test information required for testing the words of RAM.
+            ///               flushCacheLines   TRUE to flush and invalidate the block from the data cache before
+            ///                                 each read back.
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL RunBlockKernel( WordsTestParameters * pwtp, BOOL flushCacheLines )
+	        {
+	            if ( flushCacheLines )
+	            {
+	                return BlackfinDiagDataRam::RunBlockKernel( pwtp, flushCacheLines );
+	            }
+
+	            return PATTERNS::TestBlock( pwtp );
+	        }
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagDataRamSpecialised(const BlackfinDiagDataRamSpecialised &);
+
+	        const BlackfinDiagDataRamSpecialised & operator = (const BlackfinDiagDataRamSpecialised & );
+
+            BlackfinDiagDataRamSpecialised();
+
+            // The pattern list as a table, for the bytes at the ends of a range and the pattern numbers of failures.
+            UINT32                     m_TestPatterns[ PATTERNS::NMBR_TEST_PATTERNS ];
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_DATA_RAM_SPECIALISED_HPP)
@@ -0,0 +1,222 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagInstructionCompare.hpp
+///
+/// Namespace for the kernels comparing instruction RAM read via DMA to the code in the bootstream
+///
+/// @par Full Description
+///
+/// The instruction RAM test compares up to DMA_BFR_SZ bytes read from instruction memory with the code of the same
+/// block in the bootstream.  The word kernel compares 32 bits at a time once both pointers are on a word boundary,
+/// only the bytes before the first boundary and after the last whole word are compared a byte at a time.  When the
+/// two pointers are not aligned the same way there are no words to compare and every byte is compared.  A word that
+/// does not compare is compared again a byte at a time to find the first byte that does not, so emulator traps are
+/// allowed for the same way the byte kernel allows for them.  The byte kernel is the compare the test ran before, it
+/// is kept for the host benchmark of the two.
+///
+/// Defined in the header so BlackfinDiagInstructionCompareBenchmark can be built for a Linux host without the
+/// rest of the instruction RAM test.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_INSTRUCTION_COMPARE_HPP)
+#define BLACKFIN_DIAG_INSTRUCTION_COMPARE_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagAddress.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    // Exception Instruction Opcode
+    const UINT32 EMUEXCEPT_OPCODE   = 0x25;
+
+    // For finding the bytes before the first word boundary
+    const UINT32 COMPARE_WORD_ALIGNMENT_MASK = sizeof(UINT32) - 1;
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// CLASS NAME: BlackfinDiagInstructionCompare
+    ///
+    /// Compares instruction RAM read via DMA to the code in the bootstream it was loaded from.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class BlackfinDiagInstructionCompare
+    {
+        public:
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompare: CompareWords
+            ///
+            /// @par Full Description
+            ///      Compares a word at a time, a byte at a time before the first word boundary and after the last
+            ///      whole word.
+            ///
+            /// @param        pBootStreamCode     Code in the bootstream.
+            ///               pInstrMemRead       Instruction RAM read via DMA.
+            ///               nmbrBytes           Number of bytes to compare.
+            ///
+            /// @return       TRUE when there are no miscomparisons
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static inline BOOL CompareWords( const UINT8 * pBootStreamCode, const UINT8 * pInstrMemRead, UINT32 nmbrBytes )
+            {
+                BOOL checkNextByteForEmulation = FALSE;
+
+                // Words can only be compared when both are aligned the same way.
+                if ( ( reinterpret_cast<AddressValue>(pBootStreamCode) ^ reinterpret_cast<AddressValue>(pInstrMemRead) )
+                     & COMPARE_WORD_ALIGNMENT_MASK )
+                {
+                    return CompareByteRun( pBootStreamCode, pInstrMemRead, nmbrBytes, checkNextByteForEmulation );
+                }
+
+                UINT32 nmbrHeadBytes = ( sizeof(UINT32) - ( reinterpret_cast<AddressValue>(pBootStreamCode) & COMPARE_WORD_ALIGNMENT_MASK ) )
+                                       & COMPARE_WORD_ALIGNMENT_MASK;
+
+                if ( nmbrHeadBytes > nmbrBytes )
+                {
+                    nmbrHeadBytes = nmbrBytes;
+                }
+
+                if ( !CompareByteRun( pBootStreamCode, pInstrMemRead, nmbrHeadBytes, checkNextByteForEmulation ) )
+                {
+                    return FALSE;
+                }
+
+                const UINT32 * pCodeWords = reinterpret_cast<const UINT32 *>( pBootStreamCode + nmbrHeadBytes );
+
+                const UINT32 * pReadWords = reinterpret_cast<const UINT32 *>( pInstrMemRead + nmbrHeadBytes );
+
+                UINT32         nmbrWords  = ( nmbrBytes - nmbrHeadBytes ) / sizeof(UINT32);
+
+                for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+                {
+                    if ( pCodeWords[ ui ] == pReadWords[ ui ] )
+                    {
+                        checkNextByteForEmulation = FALSE;
+
+                        continue;
+                    }
+
+                    // Find the byte that did not compare.
+                    if ( !CompareByteRun( reinterpret_cast<const UINT8 *>( pCodeWords + ui ),
+                                          reinterpret_cast<const UINT8 *>( pReadWords + ui ),
+                                          sizeof(UINT32),
+                                          checkNextByteForEmulation ) )
+                    {
+                        return FALSE;
+                    }
+                }
+
+                UINT32 nmbrBytesCompared = nmbrHeadBytes + ( nmbrWords * sizeof(UINT32) );
+
+                return CompareByteRun( pBootStreamCode + nmbrBytesCompared,
+                                       pInstrMemRead   + nmbrBytesCompared,
+                                       nmbrBytes       - nmbrBytesCompared,
+                                       checkNextByteForEmulation );
+            }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompare: CompareBytes
+            ///
+            /// @par Full Description
+            ///      Compares a byte at a time.
+            ///
+            /// @param        pBootStreamCode     Code in the bootstream.
+            ///               pInstrMemRead       Instruction RAM read via DMA.
+            ///               nmbrBytes           Number of bytes to compare.
+            ///
+            /// @return       TRUE when there are no miscomparisons
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static inline BOOL CompareBytes( const UINT8 * pBootStreamCode, const UINT8 * pInstrMemRead, UINT32 nmbrBytes )
+            {
+                BOOL checkNextByteForEmulation = FALSE;
+
+                return CompareByteRun( pBootStreamCode, pInstrMemRead, nmbrBytes, checkNextByteForEmulation );
+            }
+
+        private:
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompare: CompareByteRun
+            ///
+            /// @par Full Description
+            ///      Compares a byte at a time, carrying whether the byte before was an emulator trap from one run to
+            ///      the next.
+            ///
+            /// @param        pBootStreamCode                Code in the bootstream.
+            ///               pInstrMemRead                  Instruction RAM read via DMA.
+            ///               nmbrBytes                      Number of bytes to compare.
+            ///               rCheckNextByteForEmulation     TRUE when the byte before did not compare because it was
+            ///                                              the opcode of an emulator trap.
+            ///
+            /// @return       TRUE when there are no miscomparisons
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static inline BOOL CompareByteRun( const UINT8 * pBootStreamCode,
+                                               const UINT8 * pInstrMemRead,
+                                               UINT32        nmbrBytes,
+                                               BOOL &        rCheckNextByteForEmulation )
+            {
+                for ( UINT32 ui32 = 0; ui32 < nmbrBytes; ++ui32 )
+    	        {
+    	            UINT8 instrMemRead = pInstrMemRead[ ui32 ];
+
+    	            if ( pBootStreamCode[ ui32 ] == instrMemRead )
+    	            {
+			            rCheckNextByteForEmulation = FALSE;
+
+			            continue;
+    	            }
+
+// Emulator inserts trap instructions at key places to catch breakpoints and issues.
+// Instruction memory read from DMA will not compare.  Therefore to continue testing
+// with the emulator this flag was introduced for conditional compiling.  It is
+// defined in the project settings when running with the emulator.
+#ifdef DEBUG_BUILD
+   			        if ( EMUEXCEPT_OPCODE == instrMemRead )
+   			        {
+   				        rCheckNextByteForEmulation = TRUE;
+
+   				        continue;
+   			        }
+
+   			        // The other byte of the trap instruction.
+   			        if ( rCheckNextByteForEmulation )
+   			        {
+   				        rCheckNextByteForEmulation = FALSE;
+
+   				        continue;
+   			        }
+#endif
+   			        return FALSE;
+                }
+
+                return TRUE;
+            }
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_INSTRUCTION_COMPARE_HPP)
@@ -0,0 +1,210 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagInstructionCompareBenchmark.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the
+/// BlackfinDiagInstructionCompareBenchmark class.
+///
+/// @see BlackfinDiagInstructionCompareBenchmark.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+
+// SYSTEM INCLUDES
+#include <time.h>
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Hw.h"                  // _GET_CYCLE_COUNT
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagInstructionCompareBenchmark.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+    // Multiplier and increment of the linear congruential generator choosing the code and mismatches.
+    static const UINT32 MISMATCH_LCG_MULTIPLIER = 1103515245;
+    static const UINT32 MISMATCH_LCG_INCREMENT  = 12345;
+    static const UINT32 MISMATCH_BITS_PER_BYTE  = 8;
+
+    // As the code in the bootstream and the instruction RAM read via DMA, a word more for the offset.
+    static UINT32 s_BootStreamCode[ ( COMPARE_BENCHMARK_MAX_BYTES / sizeof(UINT32) ) + 1 ];
+
+    static UINT32 s_InstrMemRead[ ( COMPARE_BENCHMARK_MAX_BYTES / sizeof(UINT32) ) + 1 ];
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: CompareKernels
+    ///
+    ///      Benchmarks both kernels for a buffer size
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagInstructionCompareBenchmark::CompareKernels( UINT32             nmbrBytes,
+                                                                  UINT32             byteOffset,
+                                                                  UINT32             nmbrPasses,
+                                                                  UINT32             seed,
+                                                                  KernelComparison & rComparison )
+    {
+        if ( ( 0 == nmbrBytes ) || ( nmbrBytes > COMPARE_BENCHMARK_MAX_BYTES ) || ( byteOffset > COMPARE_WORD_ALIGNMENT_MASK ) )
+        {
+            return FALSE;
+        }
+
+        RunKernel( BENCHMARK_COMPARE_BYTES, nmbrBytes, byteOffset, nmbrPasses, seed, rComparison.m_Bytes );
+
+        RunKernel( BENCHMARK_COMPARE_WORDS, nmbrBytes, byteOffset, nmbrPasses, seed, rComparison.m_Words );
+
+        return TRUE;
+    }
+
+    //***************************************************************************
+    // PRIVATE METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: RunKernel
+    ///
+    ///      Benchmarks one of the compare kernels
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagInstructionCompareBenchmark::RunKernel( BenchmarkKernels kernel,
+                                                             UINT32           nmbrBytes,
+                                                             UINT32           byteOffset,
+                                                             UINT32           nmbrPasses,
+                                                             UINT32           seed,
+                                                             CompareResults & rResults )
+    {
+        UINT32  random          = seed;
+
+        UINT8 * pBootStreamCode = reinterpret_cast<UINT8 *>( s_BootStreamCode ) + byteOffset;
+
+        UINT8 * pInstrMemRead   = reinterpret_cast<UINT8 *>( s_InstrMemRead ) + byteOffset;
+
+        rResults.m_NmbrFalseErrors           = 0;
+        rResults.m_NmbrMismatchesInjected    = 0;
+        rResults.m_NmbrMismatchesDetected    = 0;
+        rResults.m_NmbrBytesCompared         = 0;
+        rResults.m_Microseconds              = 0;
+        rResults.m_BytesPerSecond            = 0;
+        rResults.m_NmbrCycles                = 0;
+        rResults.m_HundredthsOfCyclesPerByte = 0;
+
+        for ( UINT32 ui = 0; ui < nmbrBytes; ++ui )
+        {
+            pBootStreamCode[ ui ] = static_cast<UINT8>( NextRandom( random ) );
+
+            pInstrMemRead[ ui ]   = pBootStreamCode[ ui ];
+        }
+
+        //
+        // Compares of buffers that are the same for the throughput, and to see the kernel reports no errors.
+        //
+        UINT64  startCycles = 0;
+
+        UINT64  endCycles   = 0;
+
+        clock_t start       = clock();
+
+        _GET_CYCLE_COUNT( startCycles );
+
+        for ( UINT32 pass = 0; pass < nmbrPasses; ++pass )
+        {
+            if ( !Compare( kernel, pBootStreamCode, pInstrMemRead, nmbrBytes ) )
+            {
+                ++rResults.m_NmbrFalseErrors;
+            }
+        }
+
+        _GET_CYCLE_COUNT( endCycles );
+
+        rResults.m_Microseconds      = ( static_cast<UINT64>( clock() - start ) * COMPARE_BENCHMARK_US_PER_SECOND )
+                                       / CLOCKS_PER_SEC;
+
+        rResults.m_NmbrCycles        = endCycles - startCycles;
+
+        rResults.m_NmbrBytesCompared = static_cast<UINT64>( nmbrBytes ) * nmbrPasses;
+
+        if ( rResults.m_Microseconds > 0 )
+        {
+            rResults.m_BytesPerSecond = ( rResults.m_NmbrBytesCompared * COMPARE_BENCHMARK_US_PER_SECOND )
+                                        / rResults.m_Microseconds;
+        }
+
+        if ( rResults.m_NmbrBytesCompared > 0 )
+        {
+            rResults.m_HundredthsOfCyclesPerByte = static_cast<UINT32>( ( rResults.m_NmbrCycles * COMPARE_BENCHMARK_HUNDREDTHS )
+                                                                        / rResults.m_NmbrBytesCompared );
+        }
+
+        //
+        // A bit of a byte at a pseudo random offset changed per pass.
+        //
+        for ( UINT32 pass = 0; pass < nmbrPasses; ++pass )
+        {
+            UINT32 offset    = NextRandom( random ) % nmbrBytes;
+
+            UINT8  savedByte = pInstrMemRead[ offset ];
+
+            pInstrMemRead[ offset ] ^= static_cast<UINT8>( 1 << ( NextRandom( random ) % MISMATCH_BITS_PER_BYTE ) );
+
+            ++rResults.m_NmbrMismatchesInjected;
+
+            if ( !Compare( kernel, pBootStreamCode, pInstrMemRead, nmbrBytes ) )
+            {
+                ++rResults.m_NmbrMismatchesDetected;
+            }
+
+            pInstrMemRead[ offset ] = savedByte;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: Compare
+    ///
+    ///      Compares the buffers with one of the compare kernels
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagInstructionCompareBenchmark::Compare( BenchmarkKernels kernel,
+                                                           const UINT8 *  pBootStreamCode,
+                                                           const UINT8 *  pInstrMemRead,
+                                                           UINT32         nmbrBytes )
+    {
+        if ( BENCHMARK_COMPARE_WORDS == kernel )
+        {
+            return BlackfinDiagInstructionCompare::CompareWords( pBootStreamCode, pInstrMemRead, nmbrBytes );
+        }
+
+        return BlackfinDiagInstructionCompare::CompareBytes( pBootStreamCode, pInstrMemRead, nmbrBytes );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: NextRandom
+    ///
+    ///      Advances the pseudo random state
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagInstructionCompareBenchmark::NextRandom( UINT32 & rRandom )
+    {
+        rRandom = ( rRandom * MISMATCH_LCG_MULTIPLIER ) + MISMATCH_LCG_INCREMENT;
+
+        // The low bits of the generator are not very random.
+        return rRandom >> 8;
+    }
+
+}
+
+#endif // defined(BLACKFIN_DIAG_HOST_BUILD)
@@ -0,0 +1,190 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagInstructionCompareBenchmark.hpp
+///
+/// Namespace for the Linux host benchmark of the instruction RAM compare kernels
+///
+/// @par Full Description
+///
+/// Only built with BLACKFIN_DIAG_HOST_BUILD defined.  The byte and word kernels of BlackfinDiagInstructionCompare are
+/// each run over a buffer of pseudo random code and a copy of it, as the bootstream and the instruction RAM read via
+/// DMA.  The buffers start a number of bytes past a word boundary so the bytes before the first boundary and after
+/// the last whole word are compared too.  The compares of the buffers as they are are timed, with clock() for the
+/// bytes per second and with _GET_CYCLE_COUNT for the cycles per byte, and any error they report is a false error.
+/// A byte of the copy is then changed at a pseudo random offset for each pass to count the mismatches each kernel
+/// detects.  The host's Hw.h has to read a cycle counter for the cycles per byte.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_INSTRUCTION_COMPARE_BENCHMARK_HPP)
+#define BLACKFIN_DIAG_INSTRUCTION_COMPARE_BENCHMARK_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagInstructionCompare.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 COMPARE_BENCHMARK_MAX_BYTES     = 0x10000;   // Largest buffer compared
+    static const UINT32 COMPARE_BENCHMARK_US_PER_SECOND = 1000000;
+    static const UINT32 COMPARE_BENCHMARK_HUNDREDTHS    = 100;
+
+    class BlackfinDiagInstructionCompareBenchmark
+    {
+        public:
+
+            // Results of benchmarking a compare kernel.
+            typedef struct
+            {
+                UINT32           m_NmbrFalseErrors;          // Errors reported comparing buffers that are the same
+                UINT32           m_NmbrMismatchesInjected;
+                UINT32           m_NmbrMismatchesDetected;
+                UINT64           m_NmbrBytesCompared;        // By the compares of buffers that are the same
+                UINT64           m_Microseconds;             // Taken by those compares
+                UINT64           m_BytesPerSecond;
+                UINT64           m_NmbrCycles;               // Taken by those compares
+                UINT32           m_HundredthsOfCyclesPerByte;
+            }
+            CompareResults;
+
+            // Which compare kernel is run.
+            typedef enum
+            {
+                BENCHMARK_COMPARE_BYTES = 0,        // BlackfinDiagInstructionCompare::CompareBytes
+                BENCHMARK_COMPARE_WORDS             // BlackfinDiagInstructionCompare::CompareWords
+            }
+            BenchmarkKernels;
+
+            // Results of comparing the kernels for a buffer size.
+            typedef struct
+            {
+                CompareResults   m_Bytes;
+                CompareResults   m_Words;
+            }
+            KernelComparison;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: BlackfinDiagInstructionCompareBenchmark
+            ///
+            /// @par Full Description
+            ///      Construction of a benchmark of the instruction RAM compare kernels.
+            ///
+            ///
+            /// @param                              None
+            ///
+            /// @return                             Benchmark instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagInstructionCompareBenchmark()
+	        {
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: CompareKernels
+            ///
+            /// @par Full Description
+            ///      Benchmarks both kernels for a buffer size.  The same seed gives the same code and mismatches.
+            ///
+            ///
+            /// @param nmbrBytes                    Bytes in the buffers compared, DMA_BFR_SZ for the test.
+            ///        byteOffset                   Bytes past a word boundary the buffers start, 0 to 3.
+            ///        nmbrPasses                   Compares timed, and mismatches injected.
+            ///        seed                         Seed of the pseudo random code and mismatches.
+            ///        rComparison                  Filled in with the results of each.
+            ///
+            /// @return                             FALSE when the buffer size or offset is out of range
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL CompareKernels( UINT32             nmbrBytes,
+	                             UINT32             byteOffset,
+	                             UINT32             nmbrPasses,
+	                             UINT32             seed,
+	                             KernelComparison & rComparison );
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagInstructionCompareBenchmark(const BlackfinDiagInstructionCompareBenchmark &);
+
+	        const BlackfinDiagInstructionCompareBenchmark & operator = (const BlackfinDiagInstructionCompareBenchmark & );
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: RunKernel
+            ///
+            /// @par Full Description
+            ///      Benchmarks one of the compare kernels.
+            ///
+            /// @param        kernel         Compare kernel run.
+            ///               nmbrBytes      Bytes in the buffers compared.
+            ///               byteOffset     Bytes past a word boundary the buffers start.
+            ///               nmbrPasses     Compares timed, and mismatches injected.
+            ///               seed           Seed of the pseudo random code and mismatches.
+            ///               rResults       Filled in with the results.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void RunKernel( BenchmarkKernels kernel,
+	                        UINT32           nmbrBytes,
+	                        UINT32           byteOffset,
+	                        UINT32           nmbrPasses,
+	                        UINT32           seed,
+	                        CompareResults & rResults );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: Compare
+            ///
+            /// @par Full Description
+            ///      Compares the buffers with one of the compare kernels.
+            ///
+            /// @param        kernel             Compare kernel run.
+            ///               pBootStreamCode    As the code in the bootstream.
+            ///               pInstrMemRead      As the instruction RAM read via DMA.
+            ///               nmbrBytes          Bytes to compare.
+            ///
+            /// @return       TRUE when there are no miscomparisons
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL Compare( BenchmarkKernels kernel, const UINT8 * pBootStreamCode, const UINT8 * pInstrMemRead, UINT32 nmbrBytes );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionCompareBenchmark: NextRandom
+            ///
+            /// @par Full Description
+            ///      Advances the pseudo random state.
+            ///
+            /// @param        rRandom        Pseudo random state.
+            ///
+            /// @return       The next pseudo random number
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 NextRandom( UINT32 & rRandom );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_INSTRUCTION_COMPARE_BENCHMARK_HPP)
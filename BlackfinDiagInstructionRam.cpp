@@ -26,6 +26,7 @@
 
 // C++ PROJECT INCLUDES
 #include "BlackfinDiagInstructionRam.hpp"
+#include "BlackfinDiagMdma.hpp"
 
 
 // FORWARD REFERENCES
@@ -33,6 +34,8 @@
 //
 namespace BlackfinDiagnosticTesting 
 {
+    UINT32 BlackfinDiagInstructionRam::m_InstrMemRead[ NMBR_DMA_BFRS ][ DMA_BFR_SZ / sizeof(UINT32) ];
+
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: BlackfinDiagInstructioRam: RunTest
@@ -45,7 +48,25 @@ namespace BlackfinDiagnosticTesting
     {
 	    ConfigForAnyNewDiagCycle( this );
 	    
-        return RunInstructionRamTestIteration( m_IcpCompare, rErrorCode );
+	    // No block of the bootstream is loaded into instruction memory, the error was reported building the index.
+	    if ( 0 == m_NmbrBlocks ) 
+	    {
+	        return DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+	    }
+	    
+        return RunInstructionRamTestIteration( m_IcpRead, m_IcpCompare, rErrorCode );
+    }
+    
+    
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionRam: GetReadBuffers
+    ///
+    ///      Get where the buffers instruction RAM is read into via DMA are.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 * BlackfinDiagInstructionRam::GetReadBuffers() 
+    {
+        return reinterpret_cast<UINT8 *>( m_InstrMemRead );
     }
     
     
@@ -56,22 +77,65 @@ namespace BlackfinDiagnosticTesting
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     DiagnosticTesting::DiagnosticTest::TestState 
-    BlackfinDiagInstructionRam::RunInstructionRamTestIteration(	InstructionCompareParams & rIcpCompare,
+    BlackfinDiagInstructionRam::RunInstructionRamTestIteration(	InstructionCompareParams & rIcpRead,
+                                                                InstructionCompareParams & rIcpCompare,
                                                                 UINT32 &                   rErrorCode ) 
     {
 		DiagnosticTesting::DiagnosticTest::TestState ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
 
 	    BOOL hasError = TRUE;	  
 	
-	    BOOL isPartialDMABuffer = ConfigureDMAReadOfInstructionMemory( rIcpCompare );
-	
-	    DmaXferMDMA0( rIcpCompare.m_pReadFromAddr, rIcpCompare.m_InstrMemRead );
+	    //
+	    // The first iteration of a diagnostic cycle starts the first read, there is nothing read to compare yet.
+	    //
+	    if ( !m_DmaInProgress ) 
+	    {
+	        StartReadOfInstructionMemory( rIcpRead );
+	        
+	        return ts;
+	    }
+	    
+	    if ( !IsDmaXferMDMA0Complete() ) 
+	    {
+	        // So DMA can't hang the test.
+	        if ( ++m_NmbrDmaPolls >= MAX_DMA_POLLS ) 
+	        {
+	            StopDmaXferMDMA0();
+	            
+   		        rErrorCode  = GetTestType() << DiagnosticTesting::DiagnosticTest::DIAG_ERROR_TYPE_BIT_POS;
+    
+   		        rErrorCode |= DMA_TIMEOUT_ERR;
+   		        
+   		        ts = DiagnosticTesting::DiagnosticTest::TEST_FAILURE;
+	        }
+	        
+	        return ts;
+	    }
+	    
+	    m_DmaInProgress = FALSE;
+	    
+	    //
+	    // Start reading the next part of instruction RAM into the other buffer, it is read while this part is compared.
+	    //
+	    rIcpCompare = rIcpRead;
+	    
+	    BOOL moreToRead = AdvanceToNextRead( rIcpRead );
+	    
+	    if ( moreToRead ) 
+	    {
+	        StartReadOfInstructionMemory( rIcpRead );
+	    }
+	    else 
+	    {
+	        ts = DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+	    }
 	
 	    hasError = !CompareInstructMemToBootStream( rIcpCompare ); 
 
         // Miscomparison results in an error return.
 	    if (hasError) 
 	    {
+	        StopDmaXferMDMA0();
 		
    		    rErrorCode  = GetTestType() << DiagnosticTesting::DiagnosticTest::DIAG_ERROR_TYPE_BIT_POS;
     
@@ -84,44 +148,64 @@ namespace BlackfinDiagnosticTesting
    		    ts = DiagnosticTesting::DiagnosticTest::TEST_FAILURE;
 	    }
 	
-	    rIcpCompare.m_CurrentBfrOffset += DMA_BFR_SZ;
+        return ts;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionRam: StartReadOfInstructionMemory
+    ///
+    ///      Configures the read of a part of instruction RAM into the other buffer and starts its DMA.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagInstructionRam::StartReadOfInstructionMemory( InstructionCompareParams & rIcp ) 
+    {
+        // The buffer being compared is not read into.
+        UINT8 * pReadBfr = reinterpret_cast<UINT8 *>( m_InstrMemRead[ 0 ] );
+        
+        if ( m_IcpCompare.m_pInstrMemRead == pReadBfr ) 
+        {
+            pReadBfr = reinterpret_cast<UINT8 *>( m_InstrMemRead[ 1 ] );
+        }
+        
+        rIcp.m_pInstrMemRead = pReadBfr;
+        
+	    rIcp.m_IsPartialRead = ConfigureDMAReadOfInstructionMemory( rIcp );
+	
+	    StartDmaXferMDMA0( rIcp.m_pReadFromAddr, rIcp.m_pInstrMemRead );
+	    
+	    m_DmaInProgress      = TRUE;
+	    
+	    m_NmbrDmaPolls       = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionRam: AdvanceToNextRead
+    ///
+    ///      Moves on to the part of instruction RAM after the one that was read.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagInstructionRam::AdvanceToNextRead( InstructionCompareParams & rIcp ) 
+    {
+	    rIcp.m_CurrentBfrOffset += DMA_BFR_SZ;
 		
-	    if (isPartialDMABuffer) 
+	    if (rIcp.m_IsPartialRead) 
 	    {
-		
-		    hasError = FALSE;
-	    	
-	        BOOL noMoreHeaders = !EnumerateNextInstructionBootStreamHeader( rIcpCompare.m_HeaderOffset, hasError );
+	        ++rIcp.m_BlockNumber;
 	    	
-	        if ( noMoreHeaders ) 
-	        {
-	        	ts = DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
-	        }
-	        else if ( hasError ) 
-	        {
-	    	    rErrorCode  = GetTestType() << DiagnosticTesting::DiagnosticTest::DIAG_ERROR_TYPE_BIT_POS;
-	    	
-	    	    rErrorCode |= BAD_BOOTSTREAM_ERR;   		
-	
-	    	    ts = DiagnosticTesting::DiagnosticTest::TEST_FAILURE;
-	        }
-	    	
-	        rIcpCompare.m_CurrentBfrOffset = 0;
-	    
+	        rIcp.m_CurrentBfrOffset = 0;
 	    }
-	
-        return ts;
+	    
+	    return ( rIcp.m_BlockNumber < m_NmbrBlocks );
     }
 
-
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///	METHOD NAME: BlackfinDiagInstructionRam: DmaXferMDMA0
+    ///	METHOD NAME: BlackfinDiagInstructionRam: StartDmaXferMDMA0
     ///
-    ///      Perform DMA transfer of instruction RAM.  The MDMA0 is used to match up with the convention that
+    ///      Start a DMA transfer of instruction RAM.  The MDMA0 is used to match up with the convention that
     ///      the AnalogDevices library uses for DMA operations in their sample code..
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    void BlackfinDiagInstructionRam::DmaXferMDMA0(void * pReadFromAddress, void * pWriteToAddress)
+    void BlackfinDiagInstructionRam::StartDmaXferMDMA0(void * pReadFromAddress, void * pWriteToAddress)
     {
         UINT nmbrOf16BitUnitsToDMA = (DMA_BFR_SZ >> 1);
     
@@ -142,96 +226,105 @@ namespace BlackfinDiagnosticTesting
         *pMDMA_D0_CURR_DESC_PTR	= NULL;
         *pMDMA_D0_NEXT_DESC_PTR	= NULL;
 
-        // Just so DMA can't hang the system but probably a while forever loop should be coded.
-        UINT32 loopCntr = 10000000;
-
         // 
         // Best source for understanding this is the ADSP-BF52X Blackfin Processor Hardware Reference, chapter 6 on DMA.
         // Also Visual DSP has some examples.
         //
-        UINT32 statusD0     = *pMDMA_D0_IRQ_STATUS;
-
         *pMDMA_S0_CONFIG    = NDSIZE_0 | WDSIZE_16       | DMAEN;
 
-        statusD0            = *pMDMA_D0_IRQ_STATUS;
-
         *pMDMA_D0_CONFIG    = NDSIZE_0 | WDSIZE_16 | WNR | DMAEN;
-    
-	    while( loopCntr ) 
-	    {
-		    statusD0 = *pMDMA_D0_IRQ_STATUS;
-		
-		    if (!(statusD0 & DMA_COMPLETE_MASK )) 
-		    {
-		        break;
-		    }
+        
+        // The read is left running between iterations, the other users of the stream release it when it completes.
+        BlackfinDiagMdma::ClaimForBackgroundTransfer();
+    }
 
-		    loopCntr--;
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionRam: IsDmaXferMDMA0Complete
+    ///
+    ///      Checks the status of the DMA transfer once, the stream is stopped when it has completed.  Another
+    ///      user of the stream may have seen it complete and stopped it already.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagInstructionRam::IsDmaXferMDMA0Complete()
+    {
+	    if ( !BlackfinDiagMdma::IsBackgroundTransferComplete() ) 
+	    {
+	        return FALSE;
 	    }
-	
-	    *pMDMA_S0_CONFIG = 0;	
-	    *pMDMA_D0_CONFIG = 0;
+	    
+	    m_DmaInProgress = FALSE;
+	    
+	    return TRUE;
+    }
 
-	    statusD0 = *pMDMA_D0_IRQ_STATUS; 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagInstructionRam: StopDmaXferMDMA0
+    ///
+    ///      Stops the stream whether or not the transfer has completed.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagInstructionRam::StopDmaXferMDMA0()
+    {
+	    BlackfinDiagMdma::ReleaseBackgroundTransfer();
+	    
+	    m_DmaInProgress  = FALSE;
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///	METHOD NAME: BlackfinDiagInstructionRam: StartEnumeratingInstructionBootStreamHeaders
+    ///	METHOD NAME: BlackfinDiagInstructionRam: BuildBlockIndex
     ///
-    ///      Called at the start of a new diagnostic cycle.
+    ///      Walks the headers of the bootstream in flash and keeps each block loaded into instruction memory.
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    BOOL BlackfinDiagInstructionRam::StartEnumeratingInstructionBootStreamHeaders( UINT32 & rHeaderOffset ) 
+    BOOL BlackfinDiagInstructionRam::BuildBlockIndex( UINT32 & rErrorCode ) 
     {
 	    const UINT8        * pBootBase = NULL;
     
 	    GetBootStreamStartAddr( pBootBase );    
     
-	    UINT32  offsetLookahead  = 0;	
 	    UINT32  offset           = 0;  
-        BOOL    success         = FALSE; 
-    
+	    
+	    UINT32  bootStreamError  = 0;
+	    
+	    m_NmbrBlocks             = 0;
     
         while (TRUE) 
         {    	
-    	    if ( offset & (sizeof(UDINT) - 1) ) 
+    	    const ADI_BOOT_HEADER * pHeader = reinterpret_cast<const ADI_BOOT_HEADER *>(pBootBase + offset);
+    	
+    	    if ( ( offset & (sizeof(UDINT) - 1) ) || ( (pHeader->dBlockCode & HDRSGN) != 0xAD000000 ) ) 
     	    {
+    	        bootStreamError = BAD_BOOTSTREAM_ERR;
+    	        
     	        break; 
     	    }
     	
-    	    ADI_BOOT_HEADER * pHeader = (ADI_BOOT_HEADER *)(pBootBase + offset);
-    	
-    	    if ( (pHeader->dBlockCode & HDRSGN) != 0xAD000000 ) 
-    	    {
-    	        break;
-    	    }
+    	    // The final header ends the bootstream, its block is not tested.
+      	    if ( (pHeader->dBlockCode & BFLAG_FINAL) ) 
+      	    {
+      	        break; 
+      	    }
     	
-    	    //
-    	    // Is target address part of instruction memory.
-    	    //
-
-
-    
-       	    BOOL targetAddrInInstrctnMmry = IsAddrLocatedInInstrctnMmry( pHeader->pTargetAddress );
-       	      
-    	    if ( targetAddrInInstrctnMmry && pHeader->dByteCount ) 
+       	    if ( IsAddrLocatedInInstrctnMmry( pHeader->pTargetAddress ) && pHeader->dByteCount ) 
     	    {	
-    		    // Yes save the header offset and exit with a true condition 
-    		    rHeaderOffset     = offset;
-    		    success           = TRUE;    		
-    		    offsetLookahead   = offset;
-    	        offsetLookahead  += sizeof(ADI_BOOT_HEADER);
-    	    
-    	        if ( !(pHeader->dBlockCode & BFLAG_FILL) ) 
+    	        if ( m_NmbrBlocks >= MAX_INSTRUCTION_RAM_BLOCKS ) 
     	        {
-                    offsetLookahead += pHeader->dByteCount;
-                }
-            
-                pHeader = (ADI_BOOT_HEADER *)(pBootBase + offsetLookahead);
-           
-    		    break;
+    	            bootStreamError = BLOCK_INDEX_FULL_ERR;
+    	            
+    	            break;
+    	        }
+    	        
+    	        InstructionRamBlock & rBlock = m_Blocks[ m_NmbrBlocks ];
+    	        
+    	        rBlock.m_pTargetAddr         = reinterpret_cast<UINT8 *>(pHeader->pTargetAddress);
+    	        rBlock.m_NmbrBytes           = pHeader->dByteCount;
+    	        rBlock.m_IsFill              = ( pHeader->dBlockCode & BFLAG_FILL ) ? TRUE : FALSE;
+    	        rBlock.m_Argument            = pHeader->dArgument;
+    	        rBlock.m_PayloadOffset       = rBlock.m_IsFill ? 0 : ( offset + sizeof(ADI_BOOT_HEADER) );
+    	        
+    	        ++m_NmbrBlocks;
     	    }
-    	    // Have not found the start of the program memory
+    	    
     	    // Calculate next block address 
     	    offset += sizeof(ADI_BOOT_HEADER);
     	
@@ -239,15 +332,23 @@ namespace BlackfinDiagnosticTesting
             {
                 offset += pHeader->dByteCount;
             }
-    	
-    	    // Are there more headers to process 
-      	    if ( (pHeader->dBlockCode & BFLAG_FINAL) ) 
-      	    {
-      	        break; 
-      	    }
+        }
+        
+        if ( 0 == m_NmbrBlocks ) 
+        {
+            bootStreamError = UNABLE_TO_START_ERR;
+        }
+        
+        if ( bootStreamError ) 
+        {
+    	    rErrorCode  = GetTestType() << DiagnosticTesting::DiagnosticTest::DIAG_ERROR_TYPE_BIT_POS;
+    
+    	    rErrorCode |= bootStreamError;
+    	    
+    	    return FALSE;
         }
 
-        return success; 
+        return TRUE; 
     }
 
 
@@ -259,17 +360,13 @@ namespace BlackfinDiagnosticTesting
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     BOOL BlackfinDiagInstructionRam::ConfigureDMAReadOfInstructionMemory( InstructionCompareParams & rIcp ) 
     {
-        const UINT8     *pBootBase = NULL;
-    
-        GetBootStreamStartAddr( pBootBase );    
-    
-   	    ADI_BOOT_HEADER * pHeader = (ADI_BOOT_HEADER *)(pBootBase + rIcp.m_HeaderOffset);
+   	    const InstructionRamBlock & rBlock = m_Blocks[ rIcp.m_BlockNumber ];
    	        	
-	    rIcp.m_pReadFromAddr      = reinterpret_cast<UINT8 *>(pHeader->pTargetAddress) + rIcp.m_CurrentBfrOffset; 	
+	    rIcp.m_pReadFromAddr      = rBlock.m_pTargetAddr + rIcp.m_CurrentBfrOffset; 	
 	
 	    BOOL isPartialRead        = TRUE;	
 	
-	    INT32 bytesLeft           = pHeader->dByteCount;	
+	    INT32 bytesLeft           = rBlock.m_NmbrBytes;	
 	
 	    bytesLeft                -= (rIcp.m_CurrentBfrOffset + DMA_BFR_SZ);
 	
@@ -281,7 +378,7 @@ namespace BlackfinDiagnosticTesting
 	    
 	    if ( isPartialRead ) 
 	    {
-		    rIcp.m_NmbrOfBytesInBuffer = pHeader->dByteCount - rIcp.m_CurrentBfrOffset;
+		    rIcp.m_NmbrOfBytesInBuffer = rBlock.m_NmbrBytes - rIcp.m_CurrentBfrOffset;
 	    }
 	    else 
 	    {
@@ -291,64 +388,6 @@ namespace BlackfinDiagnosticTesting
 	    return isPartialRead;
     }	
 		 
-    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///	METHOD NAME: BlackfinDiagInstructionRam: EnumerateNextInstructionBootStreamHeader
-    ///
-    ///      When the bootstream indicates that there is less than a DMA_BFR_SZ instruction memory left to read,
-    ///      this function is called to determine if there is another header with more data or that there is no
-    ///      more data to process.
-    ///
-    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    BOOL BlackfinDiagInstructionRam::EnumerateNextInstructionBootStreamHeader( UINT32 & rHdrOffst, BOOL & rError ) 
-    {  	
-        const UINT8              * pBootBase = NULL;
-    
-        GetBootStreamStartAddr( pBootBase );    
-    
-	    UINT32             offset   = 0; 
-        BOOL               success  = TRUE;    
-        rError  = FALSE;
-    
-        ADI_BOOT_HEADER * pHeader = (ADI_BOOT_HEADER *)(pBootBase + rHdrOffst);
-
-        while( TRUE ) 
-    	{
-   		    rHdrOffst += sizeof(ADI_BOOT_HEADER);
-
-            if ( !(pHeader->dBlockCode & BFLAG_FILL) ) 
-            {
-                rHdrOffst += pHeader->dByteCount;
-            }
-
-            pHeader = (ADI_BOOT_HEADER *)(pBootBase + rHdrOffst);
-
-            BOOL targetAddrInInstrctnMmry = IsAddrLocatedInInstrctnMmry( pHeader->pTargetAddress );
-       	      
-            if ( (pHeader->dBlockCode & HDRSGN) != 0xAD000000 ) 
-            {
-    	        rError = TRUE;
-    	    
-    	        break;
-            }
-            else if ( (pHeader->dBlockCode & BFLAG_FINAL) ) 
-            {
-                success = FALSE;
-            
-                break;
-            }
-            else if (    
-                         ( targetAddrInInstrctnMmry ) 
-                      && ( pHeader->dByteCount > 0 ) 
-                    )
-            {
-        	    break;
-            }
-        } 	 
-    
-        return success;
-    } 
-
-
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: BlackfinDiagInstructionRam: CompareInstructMemToBootStream
     ///
@@ -364,15 +403,16 @@ namespace BlackfinDiagnosticTesting
 
 	    GetBootStreamStartAddr( pBootStreamStartAddr ); 
         
-   	    const ADI_BOOT_HEADER * pHeader = reinterpret_cast<const ADI_BOOT_HEADER *>(const_cast<UINT8 *>(pBootStreamStartAddr) + rIcp.m_HeaderOffset);
+   	    const InstructionRamBlock & rBlock = m_Blocks[ rIcp.m_BlockNumber ];
    	    
-   	    if (pHeader->dBlockCode & BFLAG_FILL)
+   	    if (rBlock.m_IsFill)
    	    {
-   	        success = CompareFillBlockToInstrctnRam( pBootStreamStartAddr, rIcp );
+   	        success = CompareFillBlockToInstrctnRam( rBlock.m_Argument, rIcp );
    	    }
    	    else
    	    {
-   	        success = CompareCodeBlocktoInstrctnRam( pBootStreamStartAddr, rIcp );
+   	        success = CompareCodeBlocktoInstrctnRam( pBootStreamStartAddr + rBlock.m_PayloadOffset + rIcp.m_CurrentBfrOffset, 
+   	                                                 rIcp );
    	    }   	    
    	    
    	    return success;    
@@ -385,82 +425,12 @@ namespace BlackfinDiagnosticTesting
     ///      stream to instruction RAM memory under test.
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    BOOL BlackfinDiagInstructionRam::CompareCodeBlocktoInstrctnRam( const UINT8 * pBootStreamStartAddr, InstructionCompareParams & rIcp )
+    BOOL BlackfinDiagInstructionRam::CompareCodeBlocktoInstrctnRam( const UINT8 * pBootStreamCode, InstructionCompareParams & rIcp )
     {
-        UINT8 * pInstrMemBootStream          = const_cast<UINT8 *>(pBootStreamStartAddr + rIcp.m_HeaderOffset + sizeof(ADI_BOOT_HEADER) + rIcp.m_CurrentBfrOffset);
-        
-        UINT8   instrBootStream              = 0;
-        UINT8   instrMemRead                 = 0;
-	    BOOL    success                      = TRUE;
-	    UINT8 * pCurrentInstrctnRead         = rIcp.m_InstrMemRead;
-    
-// Emulator inserts trap instructions at key places to catch breakpoints and issues.
-// Instruction memory read from DMA will not compare.  Therefore to continue testing
-// with the emulator this flag was introduced for conditional compiling.  It is 
-// defined in the project settings when running with the emulator.
-#ifdef DEBUG_BUILD
-        BOOL    checkNextByteForEmulation    = FALSE;
-        UINT8 * pPrevInstrMemBootStreamAddr  = NULL;
-#endif
-        for (UINT32 ui32 = 0; ui32 < rIcp.m_NmbrOfBytesInBuffer; ++ui32 ) 
-    	{
-    	    instrBootStream = *pInstrMemBootStream;
-    	    instrMemRead    = *pCurrentInstrctnRead;
-    	
-    	    if (instrBootStream == instrMemRead) 
-    	    {
-
-    	        ++pCurrentInstrctnRead;    	
-    	        ++pInstrMemBootStream;
-    		
-#ifdef DEBUG_BUILD
-			    checkNextByteForEmulation = FALSE;
-#endif
-			    continue;
-    	    }
-    	    else 
-    	    {
-    		    success = FALSE;
-    		
-#ifdef DEBUG_BUILD
-   			    if ( EMUEXCEPT_OPCODE == instrMemRead ) 
-   			    {
-   				    success                     = TRUE;
-   				    checkNextByteForEmulation   = TRUE;
-   				    pPrevInstrMemBootStreamAddr = pInstrMemBootStream;
-   				    success                     = TRUE;
-  				
-                    ++pCurrentInstrctnRead;    	
-                    ++pInstrMemBootStream;
-    		
-   				    continue;
-  			    }
-   			    else if (checkNextByteForEmulation) 
-   			    {
-   				    if ( ( pPrevInstrMemBootStreamAddr + 1 ) == (pInstrMemBootStream) ) 
-   					{
-   					    checkNextByteForEmulation = FALSE;
-   					    success                   = TRUE;
-    					
-   	                    ++pCurrentInstrctnRead;
-           	            ++pInstrMemBootStream;
-    		
-   					    continue;
-   				    }
-   			    }
-   			    else
-   			    {
-   			        break;   			
-    		    }   		    
-#else
-
-   		        break;
-#endif   		        
-            }
-        }
-    
-
-        return success; 
+        // The buffer read into is word aligned, and so is the code of a block as the headers are.
+        return BlackfinDiagInstructionCompare::CompareWords( pBootStreamCode, 
+                                                             rIcp.m_pInstrMemRead, 
+                                                             rIcp.m_NmbrOfBytesInBuffer );
     }
 
      ///////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -470,15 +440,12 @@ namespace BlackfinDiagnosticTesting
     ///      stream to instruction RAM memory under test.
     ///
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-    BOOL BlackfinDiagInstructionRam::CompareFillBlockToInstrctnRam( const UINT8 * pBootStreamStartAddr, InstructionCompareParams & rIcp )
+    BOOL BlackfinDiagInstructionRam::CompareFillBlockToInstrctnRam( UINT32 fillValue, InstructionCompareParams & rIcp )
     {
-         
-   	    const ADI_BOOT_HEADER * pHeader = reinterpret_cast<const ADI_BOOT_HEADER *>(const_cast<UINT8 *>(pBootStreamStartAddr) + rIcp.m_HeaderOffset);
-   	    
         BOOL success = TRUE;
 
         UINT32   instrMemRead                 = 0;
-	    UINT32 * pCurrentInstrctnRead         = reinterpret_cast<UINT32 *>(rIcp.m_InstrMemRead);
+	    UINT32 * pCurrentInstrctnRead         = reinterpret_cast<UINT32 *>(rIcp.m_pInstrMemRead);
 
 	    for (UINT32 ui32 = 0; ui32 < rIcp.m_NmbrOfBytesInBuffer; ui32 += 4 ) 
     	{
@@ -486,7 +453,7 @@ namespace BlackfinDiagnosticTesting
 
 			++pCurrentInstrctnRead;
 
-			if (instrMemRead == pHeader->dArgument) 
+			if (instrMemRead == fillValue) 
     	    {
 			    continue;
     	    }
@@ -523,26 +490,42 @@ namespace BlackfinDiagnosticTesting
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     void BlackfinDiagInstructionRam::ConfigureForNextTestCycle() 
     {
-        m_IcpCompare.m_HeaderOffset           = INITIAL_HDR_OFFSET;
-	
-	    m_IcpCompare.m_CurrentBfrOffset       = INITIAL_BFR_OFFSET;
+        // A read left from a cycle that did not complete is not compared.
+        if ( m_DmaInProgress ) 
+        {
+            StopDmaXferMDMA0();
+        }
+        
+        m_IcpRead.m_pInstrMemRead             = NULL;
+        
+        m_IcpRead.m_BlockNumber               = INITIAL_BLOCK_NUMBER;
 	
-        m_IcpCompare.m_NmbrOfBytesInBuffer    = INITIAL_NUM_BYTES_IN_BFR;
+	    m_IcpRead.m_CurrentBfrOffset          = INITIAL_BFR_OFFSET;
 	
-	    m_IcpCompare.m_pReadFromAddr          = NULL;
+        m_IcpRead.m_NmbrOfBytesInBuffer       = INITIAL_NUM_BYTES_IN_BFR;
 	
-	    BOOL enumerationNotStarted = !StartEnumeratingInstructionBootStreamHeaders( m_IcpCompare.m_HeaderOffset );
+	    m_IcpRead.m_pReadFromAddr             = NULL;
+	    
+	    m_IcpRead.m_IsPartialRead             = FALSE;
+	    
+	    m_IcpCompare                          = m_IcpRead;
 	
-	    if ( enumerationNotStarted) 
+	    //
+	    // The bootstream in flash does not change while running, it is walked the first cycle after power up only.
+	    //
+	    if ( !m_BlockIndexBuilt ) 
 	    {
-		    //
-    	    // An error report it to scheduler
-    	    //
-    	    UINT32 errorCode  = GetTestType() << DiagnosticTesting::DiagnosticTest::DIAG_ERROR_TYPE_BIT_POS;
-    
-    	    errorCode |= UNABLE_TO_START_ERR;
-    		
-		    OS_Assert( errorCode );
+	        UINT32 errorCode = 0;
+	        
+	        if ( !BuildBlockIndex( errorCode ) ) 
+	        {
+		        //
+    	        // An error report it to scheduler
+    	        //
+		        OS_Assert( errorCode );
+	        }
+	        
+	        m_BlockIndexBuilt = TRUE;
    	    }    	
     }
 
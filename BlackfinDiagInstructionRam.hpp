@@ -8,7 +8,15 @@
 /// 
 /// Diagnostic testing for the Blackfin instruction RAM.  Instruction RAM is not directly addressable and thus must be
 /// read via DMA.  The intruction memory read is compared to the instruction data in the bootstream flash and an error
-/// occurs when there is a mismatch.
+/// occurs when there is a mismatch.  The headers of the bootstream are walked once, the first diagnostic cycle after 
+/// power up, and the instruction memory blocks found are kept in a table in RAM.  The target address, byte count, 
+/// whether it is a fill block, the fill value and where the code is in the bootstream are all taken from the table 
+/// after that, so an iteration does not read the headers from flash.
+///
+/// Instruction memory is read into two buffers in turn.  The read of the next part of instruction memory is started
+/// before the part already read is compared, so the DMA runs while the core compares.  Whether the read has completed
+/// is checked with the DMA status at the next iteration of the test rather than waited on.  The first iteration of a
+/// diagnostic cycle only starts a read, there is nothing to compare yet.
 ///
 /// @if REVISION_HISTORY_INCLUDED
 /// @par Edit History
@@ -29,6 +37,7 @@
  
 // C++ PROJECT INCLUDES
 #include "DiagnosticTesting.hpp"
+#include "BlackfinDiagInstructionCompare.hpp"
 
 // FORWARD REFERENCES
 // (none)
@@ -38,18 +47,27 @@ namespace BlackfinDiagnosticTesting
     static const UINT32  BAD_BOOTSTREAM_ERR          = 0xffd00000;
     static const UINT32  UNABLE_TO_START_ERR         = 0xfff00000;
     static const UINT32  MISMATCH_ERR                = 0xffe00000;
+    static const UINT32  BLOCK_INDEX_FULL_ERR        = 0xffc00000;
+    static const UINT32  DMA_TIMEOUT_ERR             = 0xffb00000;
     static const UINT32  PROGRAM_MEMORY_ADDRESS_MASK = 0xffa00000;
+    static const UINT32  MAX_INSTRUCTION_RAM_BLOCKS  = 64;     // Instruction memory blocks of the bootstream indexed
     // Size of DMA buffer
 	const UINT32 DMA_BFR_SZ         = 256;
-    
-    // Exception Instruction Opcode
-    const UINT32 EMUEXCEPT_OPCODE   = 0x25;
+	
+	// One buffer is compared while the other is read into
+	const UINT32 NMBR_DMA_BFRS      = 2;
+	
+	// Bytes of all the buffers read into, excluded from the data RAM tests
+	const UINT32 READ_BFRS_SZ       = NMBR_DMA_BFRS * DMA_BFR_SZ;
+	
+	// Iterations of the test a read may take to complete, it should have completed by the next iteration
+	const UINT32 MAX_DMA_POLLS      = 100;
     
     // For determining when DMA is complete
 	const UINT32 DMA_COMPLETE_MASK  = 8;
            
-    // For reading boot stream data
-	const UINT32 INITIAL_HDR_OFFSET = 0;
+    // For walking the block index
+	const UINT32 INITIAL_BLOCK_NUMBER = 0;
 	
 	// For processing instruction ram via DMA
 	const UINT32 INITIAL_BFR_OFFSET = 0;
@@ -80,10 +98,14 @@ namespace BlackfinDiagnosticTesting
 	        BlackfinDiagInstructionRam( DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData) 
 		            		         :  DiagnosticTest              ( rTestData ),
 #if defined(BLACKFIN_DIAG_DEBUG_INSTR_RAM_BUILD)       
-                                        m_pBootStreamStartAddr      ( reinterpret_cast<UINT8 *>(0x20000000))
+                                        m_pBootStreamStartAddr      ( reinterpret_cast<UINT8 *>(0x20000000)),
 #else
-                                        m_pBootStreamStartAddr      ( reinterpret_cast<UINT8 *>(NVS_MAIN_START_ADDR ))
+                                        m_pBootStreamStartAddr      ( reinterpret_cast<UINT8 *>(NVS_MAIN_START_ADDR )),
 #endif
+                                        m_NmbrBlocks                ( 0 ),
+                                        m_BlockIndexBuilt           ( FALSE ),
+                                        m_DmaInProgress             ( FALSE ),
+                                        m_NmbrDmaPolls              ( 0 )
 	        {
 	        }
 	
@@ -103,6 +125,22 @@ namespace BlackfinDiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             DiagnosticTesting::DiagnosticTest::TestState RunTest( UINT32 & ErrorCode );
 
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionRam: GetReadBuffers
+            ///
+            /// @par Full Description
+            ///      Get where the buffers instruction RAM is read into via DMA are.  A read is left running between 
+            ///      iterations of the test, and DMA does not stop while interrupts are disabled, so the data RAM tests
+            ///      exclude the READ_BFRS_SZ bytes there.
+            ///      
+            ///
+            /// @param                            None.
+            ///                               
+            /// @return                           The first of the buffers
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static UINT8 * GetReadBuffers();
+
         protected:
 
 	        //***************************************************************************
@@ -130,23 +168,57 @@ namespace BlackfinDiagnosticTesting
             // DMA data containing instruction RAM is read into this buffer.
             UINT8 *                      m_pDmaBfr[ DMA_BFR_SZ ];
     
+            // An instruction memory block of the bootstream, taken from its header.
+            typedef struct 
+            {
+                UINT8 *        m_pTargetAddr;                 // Where the block is loaded in instruction memory
+                UINT32         m_NmbrBytes;                   // Byte count of the block
+                BOOL           m_IsFill;                      // TRUE for a fill block, there is no code in the bootstream
+                UINT32         m_Argument;                    // Value a fill block is filled with
+                UINT32         m_PayloadOffset;               // Offset of the code from the start of the bootstream
+            } 
+            InstructionRamBlock;
+    
             // For keeping track of the progress of instruction RAM testing.
             typedef struct InstructionComparisonParams 
             { 
-	            UINT8          m_InstrMemRead[DMA_BFR_SZ];   // Instruction Memory Read via DMA
-                UINT32         m_HeaderOffset;                // Offset from begining of Current Bootstream Header
+	            UINT8 *        m_pInstrMemRead;               // Buffer the instruction memory is read into via DMA
+                UINT32         m_BlockNumber;                 // Block of the block index being compared
                 UINT32         m_CurrentBfrOffset;            // Current Offset from begining of bootstream data for Instruction Ram comparisons
                 UINT32         m_NmbrOfBytesInBuffer;         // Number of Bytes to Compare
                 UINT8 *        m_pReadFromAddr;                // Address instruction RAM start for Current DMA buffer
+                BOOL           m_IsPartialRead;               // Last read of the block
             } 
             InstructionCompareParams;
     
-	        // Current status data for testing instruction RAM
+            // Instruction memory is read via DMA into these buffers in turn, words so they are aligned.  Static so the
+            // data RAM tests can exclude them from the time they are constructed.
+            static UINT32                m_InstrMemRead[ NMBR_DMA_BFRS ][ DMA_BFR_SZ / sizeof(UINT32) ];
+            
+	        // Current status data for testing instruction RAM, the part of it read and being compared.
 	        InstructionCompareParams     m_IcpCompare;
+	        
+	        // The part of instruction RAM being read via DMA while the part read before it is compared.
+	        InstructionCompareParams     m_IcpRead;
 	
             // Where the bootstream is located in FLASH
             const UINT8 *                m_pBootStreamStartAddr;
             
+            // The instruction memory blocks of the bootstream in the order they are in the bootstream.
+            InstructionRamBlock          m_Blocks[ MAX_INSTRUCTION_RAM_BLOCKS ];
+            
+            // Number of blocks in the block index.
+            UINT32                       m_NmbrBlocks;
+            
+            // TRUE once the bootstream has been walked and the block index built.
+            BOOL                         m_BlockIndexBuilt;
+            
+            // TRUE while the DMA for m_IcpRead has been started and not found completed.
+            BOOL                         m_DmaInProgress;
+            
+            // Iterations the DMA in progress has been checked at.
+            UINT32                       m_NmbrDmaPolls;
+            
 	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
 	        // If using C++ 11 and later use the delete keyword to do this.
 	        //
@@ -167,14 +239,14 @@ namespace BlackfinDiagnosticTesting
             ///      Compare the instruction RAM contents read via DMA to the contents of a block of code in the boot 
             ///      stream to instruction RAM memory under test.
             ///
-            /// @param        pBootStreamStartAddr  Start address of the boot stream
+            /// @param        pBootStreamCode       Code in the boot stream for the instruction RAM read
             ///               rIcpCompare           Data used to cycle through all of the Blackfin instruction RAM 
             ///                                     iteratively.
             ///                               
             /// @return       TRUE when there are no miscomparisons between the bootstream and the instruction RAM
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            BOOL CompareCodeBlocktoInstrctnRam( const UINT8 * pBootStreamStartAddr, InstructionCompareParams & rIcp );
+            BOOL CompareCodeBlocktoInstrctnRam( const UINT8 * pBootStreamCode, InstructionCompareParams & rIcp );
             
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagInstructionRam: CompareFillBlockToInstrctnRam
@@ -183,14 +255,14 @@ namespace BlackfinDiagnosticTesting
             ///      Compare the instruction RAM contents read via DMA to the contents of a fill block in the boot 
             ///      stream to instruction RAM memory under test.
             ///
-            /// @param        pBootStreamStartAddr  Start address of the boot stream
+            /// @param        fillValue             Value the fill block fills instruction RAM with
             ///               rIcpCompare           Data used to cycle through all of the Blackfin instruction RAM 
             ///                                     iteratively.
             ///                               
             /// @return       TRUE when there are no miscomparisons between the bootstream and the instruction RAM
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            BOOL CompareFillBlockToInstrctnRam( const UINT8 * pBootStreamStartAddr, InstructionCompareParams & rIcp );
+            BOOL CompareFillBlockToInstrctnRam( UINT32 fillValue, InstructionCompareParams & rIcp );
 
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagInstructionRam: CompareInstructMemToBootStream
@@ -222,11 +294,11 @@ namespace BlackfinDiagnosticTesting
             BOOL                                         ConfigureDMAReadOfInstructionMemory( InstructionCompareParams & rIcp );
 
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            ///	METHOD NAME: BlackfinDiagInstructionRam: DmaXferMDMA0
+            ///	METHOD NAME: BlackfinDiagInstructionRam: StartDmaXferMDMA0
             ///
             /// @par Full Description
-            ///      Perform DMA transfer of instruction RAM.  The MDMA0 is used to match up with the convention that
-            ///      the AnalogDevices library uses for DMA operations in their sample code..
+            ///      Start a DMA transfer of instruction RAM, it is not waited on.  The MDMA0 is used to match up with 
+            ///      the convention that the AnalogDevices library uses for DMA operations in their sample code..
             ///
             /// @param        pReadFromAddress    Instruction RAM address to read from. 
             ///               pWriteToAddress     RAM buffer where data is transferred to.
@@ -234,23 +306,76 @@ namespace BlackfinDiagnosticTesting
             /// @return       None
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            void                                         DmaXferMDMA0(void * pReadFromAddress, void * pWriteToAddress);
+            void                                         StartDmaXferMDMA0(void * pReadFromAddress, void * pWriteToAddress);
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionRam: IsDmaXferMDMA0Complete
+            ///
+            /// @par Full Description
+            ///      Checks the status of the DMA transfer that was started once, the stream is stopped when it has 
+            ///      completed.
+            ///
+            /// @param        None
+            ///                               
+            /// @return       TRUE when the transfer has completed
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL                                         IsDmaXferMDMA0Complete();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionRam: StopDmaXferMDMA0
+            ///
+            /// @par Full Description
+            ///      Stops the stream whether or not the transfer has completed.
+            ///
+            /// @param        None
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void                                         StopDmaXferMDMA0();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionRam: StartReadOfInstructionMemory
+            ///
+            /// @par Full Description
+            ///      Configures the read of the part of instruction RAM in rIcp into the other buffer than the one 
+            ///      being compared and starts its DMA.
+            ///
+            /// @param        rIcp                The part of instruction RAM to read.
+            ///                               
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void                                         StartReadOfInstructionMemory( InstructionCompareParams & rIcp );
 
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            ///	METHOD NAME: BlackfinDiagInstructionRam: EnumerateNextInstructionBootStreamHeader
+            ///	METHOD NAME: BlackfinDiagInstructionRam: AdvanceToNextRead
             ///
             /// @par Full Description
-            ///      When the bootstream indicates that there is less than a DMA_BFR_SZ instruction memory left to read,
-            ///      this function is called to determine if there is another header with more data or that there is no
-            ///      more data to process.
+            ///      Moves on to the part of instruction RAM after the one that was read, the next buffer of the same 
+            ///      block or the start of the next block.
             ///
-            /// @param        rHdrOffst           New offset into bootstream if there is more data. 
-            ///               rError              TRUE when the bootstream is in error.
+            /// @param        rIcp                The part of instruction RAM that was read, updated to the next part.
             ///                               
-            /// @return       TRUE when there is more instruction RAM to process.
+            /// @return       FALSE when all of the instruction RAM has been read this diagnostic cycle
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            BOOL                                         EnumerateNextInstructionBootStreamHeader( UINT32 & rHdrOffst, BOOL & rError );   	
+            BOOL                                         AdvanceToNextRead( InstructionCompareParams & rIcp );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagInstructionRam: BuildBlockIndex
+            ///
+            /// @par Full Description
+            ///      Walks the headers of the bootstream in flash and keeps each block loaded into instruction memory 
+            ///      in the block index.  The walk ends at the final header.
+            ///
+            /// @param        rErrorCode          Error of the bootstream when the index could not be built.
+            ///                               
+            /// @return       TRUE when the index was built with at least one block.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL                                         BuildBlockIndex( UINT32 & rErrorCode );
 
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagInstructionRam: GetBootStreamStartAddr
@@ -271,28 +396,17 @@ namespace BlackfinDiagnosticTesting
             /// @par Full Description
             ///      Run the next iteration of the instruction RAM test.
             ///
-            /// @param        rIcpCompare    Contains parameters for running the next interation
+            /// @param        rIcpRead       The part of instruction RAM being read via DMA.
+            ///               rIcpCompare    The part of instruction RAM read that is compared this iteration
             ///               rErrorCode     Encoded error information if test detects a failure.
             ///
             /// @return       TestState      status of the test.
             ///
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-			DiagnosticTesting::DiagnosticTest::TestState RunInstructionRamTestIteration( InstructionCompareParams & rIcpCompare,
+			DiagnosticTesting::DiagnosticTest::TestState RunInstructionRamTestIteration( InstructionCompareParams & rIcpRead,
+			                                                                             InstructionCompareParams & rIcpCompare,
 							                                                             UINT32 &                   rErrorCode	);
 																
-            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-            ///	METHOD NAME: BlackfinDiagInstructionRam: StartEnumeratingInstructionBootStreamHeaders
-            ///
-            /// @par Full Description
-            ///      Called at the start of a new diagnostic cycle.
-            ///
-            /// @param        rHeaderOffset  Offset into bootstream header
-            ///
-            /// @return       TRUE when bootstream is valid.
-            ///
-            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
-	        BOOL                                         StartEnumeratingInstructionBootStreamHeaders(UINT32 & rHeaderOffset);
-
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: BlackfinDiagInstructionRam: IsAddrLocatedInInstrctnMmry
             ///
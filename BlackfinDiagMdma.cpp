@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagMdma.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagMdma class.
+///
+/// @see BlackfinDiagMdma.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+#include "Os_iotk.h"             // This file depends on Defs.h.  It should include that file
+#include "Hw.h"                  // Ditto
+#endif
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagAddress.hpp"
+#include "BlackfinDiagMdma.hpp"
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+#include "BlackfinDiagRamSimulator.hpp"
+#endif
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+    BOOL BlackfinDiagMdma::m_BackgroundTransferInProgress = FALSE;
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: BlackfinDiagMdma
+    ///
+    ///      Construction of the memory DMA copy engine
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BlackfinDiagMdma::BlackfinDiagMdma()
+        :   m_CopyInProgress          ( FALSE )
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+            ,
+            m_SimulatedBusy           ( FALSE ),
+            m_pSimulatedSource        ( NULL ),
+            m_pSimulatedDestination   ( NULL ),
+            m_SimulatedNmbrWords      ( 0 )
+#endif
+    {
+        m_Statistics.m_NmbrCopies         = 0;
+        m_Statistics.m_NmbrWordsCopied    = 0;
+        m_Statistics.m_NmbrCopiesRefused  = 0;
+        m_Statistics.m_NmbrCopiesTimedOut = 0;
+        m_Statistics.m_TicksWaiting       = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: IsBusy
+    ///
+    ///      Determines if memory DMA stream 0 is in use
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagMdma::IsBusy()
+    {
+        // A completed background transfer is released here rather than left until its owner next looks.
+        if ( m_CopyInProgress || !IsBackgroundTransferComplete() )
+        {
+            return TRUE;
+        }
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+        return m_SimulatedBusy;
+#else
+        //
+        // Best source for understanding this is the ADSP-BF52X Blackfin Processor Hardware Reference, chapter 6 on DMA.
+        //
+        return (    ( *pMDMA_S0_CONFIG & DMAEN )
+                 || ( *pMDMA_D0_CONFIG & DMAEN )
+                 || ( *pMDMA_D0_IRQ_STATUS & MDMA_RUNNING_MASK ) );
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: StartCopy
+    ///
+    ///      Starts copying a block of words
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagMdma::StartCopy( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords )
+    {
+        if (    ( 0 == nmbrWords )
+             || ( nmbrWords > MDMA_MAX_WORDS_PER_COPY )
+             || !IsReachableByDma( pSource, nmbrWords )
+             || !IsReachableByDma( pDestination, nmbrWords )
+             || IsBusy() )
+        {
+            ++m_Statistics.m_NmbrCopiesRefused;
+
+            return FALSE;
+        }
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+        m_pSimulatedSource      = pSource;
+        m_pSimulatedDestination = pDestination;
+        m_SimulatedNmbrWords    = nmbrWords;
+#else
+        *pMDMA_S0_X_COUNT   	= nmbrWords;
+        *pMDMA_S0_X_MODIFY  	= MDMA_BYTES_PER_WORD;
+        *pMDMA_S0_Y_COUNT   	= 0;
+        *pMDMA_S0_Y_MODIFY  	= 0;
+        *pMDMA_S0_START_ADDR	= const_cast<UINT32 *>( pSource );
+        *pMDMA_S0_CURR_DESC_PTR	= NULL;
+        *pMDMA_S0_NEXT_DESC_PTR	= NULL;
+
+        *pMDMA_D0_X_COUNT   	= nmbrWords;
+        *pMDMA_D0_X_MODIFY  	= MDMA_BYTES_PER_WORD;
+        *pMDMA_D0_Y_COUNT   	= 0;
+        *pMDMA_D0_Y_MODIFY  	= 0;
+        *pMDMA_D0_START_ADDR	= pDestination;
+        *pMDMA_D0_CURR_DESC_PTR	= NULL;
+        *pMDMA_D0_NEXT_DESC_PTR	= NULL;
+
+        *pMDMA_S0_CONFIG        = NDSIZE_0 | WDSIZE_32       | DMAEN;
+
+        *pMDMA_D0_CONFIG        = NDSIZE_0 | WDSIZE_32 | WNR | DMAEN;
+#endif
+
+        m_CopyInProgress = TRUE;
+
+        ++m_Statistics.m_NmbrCopies;
+
+        m_Statistics.m_NmbrWordsCopied += nmbrWords;
+
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: WaitForCopy
+    ///
+    ///      Waits for the copy that was started to complete and stops the stream
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagMdma::WaitForCopy()
+    {
+        if ( !m_CopyInProgress )
+        {
+            return TRUE;
+        }
+
+        BOOL copyCompleted = FALSE;
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+        for ( UINT32 ui = 0; ui < m_SimulatedNmbrWords; ++ui )
+        {
+            BlackfinDiagRamSimulator::WriteWord( m_pSimulatedDestination + ui,
+                                                 BlackfinDiagRamSimulator::ReadWord( m_pSimulatedSource + ui ) );
+        }
+
+        m_Statistics.m_TicksWaiting += m_SimulatedNmbrWords * MDMA_SIMULATED_CCLK_PER_WORD;
+
+        copyCompleted = TRUE;
+#else
+        UINT64 startTimestamp = 0;
+
+        UINT64 endTimestamp   = 0;
+
+        _GET_CYCLE_COUNT( startTimestamp );
+
+        for ( UINT32 loopCntr = MDMA_WAIT_LOOP_COUNT; loopCntr > 0; --loopCntr )
+        {
+		    if ( !( *pMDMA_D0_IRQ_STATUS & MDMA_RUNNING_MASK ) )
+		    {
+		        copyCompleted = TRUE;
+
+		        break;
+		    }
+        }
+
+	    *pMDMA_S0_CONFIG = 0;
+	    *pMDMA_D0_CONFIG = 0;
+
+	    // Clear the done status for the next copy.
+	    *pMDMA_D0_IRQ_STATUS = DMA_DONE;
+
+        _GET_CYCLE_COUNT( endTimestamp );
+
+        m_Statistics.m_TicksWaiting += endTimestamp - startTimestamp;
+#endif
+
+        if ( !copyCompleted )
+        {
+            ++m_Statistics.m_NmbrCopiesTimedOut;
+        }
+
+        m_CopyInProgress = FALSE;
+
+        return copyCompleted;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: GetStatistics
+    ///
+    ///      Get the counts kept of the copies done
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagMdma::GetStatistics( MdmaStatistics & rStatistics )
+    {
+        rStatistics = m_Statistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: ClaimForBackgroundTransfer
+    ///
+    ///      Claims the stream for a transfer that has been started and is left running
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagMdma::ClaimForBackgroundTransfer()
+    {
+        m_BackgroundTransferInProgress = TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: IsBackgroundTransferComplete
+    ///
+    ///      Checks the background transfer once, the stream is released when it has completed
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagMdma::IsBackgroundTransferComplete()
+    {
+        if ( !m_BackgroundTransferInProgress )
+        {
+            return TRUE;
+        }
+
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+        // The simulated stream completes a transfer as soon as it is started.
+        if ( *pMDMA_D0_IRQ_STATUS & MDMA_RUNNING_MASK )
+        {
+            return FALSE;
+        }
+#endif
+
+        ReleaseBackgroundTransfer();
+
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: ReleaseBackgroundTransfer
+    ///
+    ///      Stops the background transfer and releases the stream
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagMdma::ReleaseBackgroundTransfer()
+    {
+        if ( !m_BackgroundTransferInProgress )
+        {
+            return;
+        }
+
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+	    *pMDMA_S0_CONFIG = 0;
+	    *pMDMA_D0_CONFIG = 0;
+
+	    // Clear the done status so the stream is seen as free by the other users of it.
+	    *pMDMA_D0_IRQ_STATUS = DMA_DONE;
+#endif
+
+        m_BackgroundTransferInProgress = FALSE;
+    }
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: SetSimulatedBusy
+    ///
+    ///      Makes the simulated stream look like it is in use by someone else
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagMdma::SetSimulatedBusy( BOOL busy )
+    {
+        m_SimulatedBusy = busy;
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagMdma: IsReachableByDma
+    ///
+    ///      Determines if a block of words can be reached by DMA
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagMdma::IsReachableByDma( const UINT32 * pFirstWord, UINT32 nmbrWords )
+    {
+        AddressValue blockStart = reinterpret_cast<AddressValue>( pFirstWord );
+
+        AddressValue blockEnd   = blockStart + ( nmbrWords * MDMA_BYTES_PER_WORD );
+
+        return !( ( blockStart < L1_SCRATCHPAD_END ) && ( L1_SCRATCHPAD_START < blockEnd ) );
+    }
+
+}
@@ -0,0 +1,255 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagMdma.hpp
+///
+/// Namespace for the memory DMA copy engine used by the diagnostic tests
+///
+/// @par Full Description
+///
+/// Copies blocks of 32 bit words with memory DMA stream 0, the stream the instruction RAM test reads instruction
+/// memory with.  A copy is started and then waited on, a copy is refused when the stream is already in use so the
+/// caller can copy with the core instead.  The instruction RAM test leaves its reads running between its iterations,
+/// it claims the stream as a background transfer while one is.  Every user shares the one claim, whichever first sees
+/// the background transfer has completed stops the stream and releases it, so copies are not refused for the time
+/// between a read completing and the instruction RAM test's next iteration.  The L1 scratchpad can not be reached by
+/// DMA, copies to or from it are refused too.  When built for a Linux host with BLACKFIN_DIAG_HOST_BUILD defined the
+/// stream is simulated, the words are copied when the copy is waited on and the cycles a transfer would take are
+/// counted so the sequencing and throughput of the callers can be tested without the hardware.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_MDMA_HPP)
+#define BLACKFIN_DIAG_MDMA_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+// (none)
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 MDMA_MAX_WORDS_PER_COPY     = 0xffff;      // X_COUNT is 16 bits
+    static const UINT32 MDMA_WAIT_LOOP_COUNT        = 10000000;    // So a DMA can't hang the system
+    static const UINT32 MDMA_RUNNING_MASK           = 8;           // DMA_RUN of the IRQ_STATUS register
+    static const UINT32 MDMA_BYTES_PER_WORD         = 4;
+    static const UINT32 L1_SCRATCHPAD_START         = 0xffb00000;  // Not reachable by DMA
+    static const UINT32 L1_SCRATCHPAD_END           = 0xffb01000;
+    static const UINT32 MDMA_SIMULATED_CCLK_PER_WORD = 6;          // One 32 bit transfer per SCLK, CCLK is 6 SCLKs
+
+    class BlackfinDiagMdma
+    {
+        public:
+
+            // Counts kept of the copies done, for measuring throughput.
+            typedef struct
+            {
+                UINT32           m_NmbrCopies;
+                UINT32           m_NmbrWordsCopied;
+                UINT32           m_NmbrCopiesRefused;
+                UINT32           m_NmbrCopiesTimedOut;
+                UINT64           m_TicksWaiting;
+            }
+            MdmaStatistics;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: BlackfinDiagMdma
+            ///
+            /// @par Full Description
+            ///      Construction of the memory DMA copy engine.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           Memory DMA copy engine instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagMdma();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: IsBusy
+            ///
+            /// @par Full Description
+            ///      Determines if memory DMA stream 0 is in use.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           TRUE when the stream is in use
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL IsBusy();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: StartCopy
+            ///
+            /// @par Full Description
+            ///      Starts copying a block of words.  The copy is refused when the stream is in use, when either block
+            ///      can not be reached by DMA or when the block is too large for one transfer.
+            ///
+            ///
+            /// @param      pSource               First word to copy from.
+            ///             pDestination          First word to copy to.
+            ///             nmbrWords             Number of words to copy.
+            ///
+            /// @return                           TRUE when the copy was started
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL StartCopy( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: WaitForCopy
+            ///
+            /// @par Full Description
+            ///      Waits for the copy that was started to complete and stops the stream.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           TRUE when the copy completed, FALSE if it timed out
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL WaitForCopy();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: GetStatistics
+            ///
+            /// @par Full Description
+            ///      Get the counts kept of the copies done.
+            ///
+            ///
+            /// @param      rStatistics           Filled in with the counts.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetStatistics( MdmaStatistics & rStatistics );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: ClaimForBackgroundTransfer
+            ///
+            /// @par Full Description
+            ///      Claims the stream for a transfer that has been started and is left running, the stream is in use
+            ///      until the transfer is seen to complete or is released.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static void ClaimForBackgroundTransfer();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: IsBackgroundTransferComplete
+            ///
+            /// @par Full Description
+            ///      Checks the background transfer once.  When it has completed the stream is stopped and released.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           TRUE when there is no background transfer running
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static BOOL IsBackgroundTransferComplete();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: ReleaseBackgroundTransfer
+            ///
+            /// @par Full Description
+            ///      Stops the background transfer whether or not it has completed and releases the stream.  Nothing
+            ///      is done when there is no background transfer, the stream may be in use by a copy.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static void ReleaseBackgroundTransfer();
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: SetSimulatedBusy
+            ///
+            /// @par Full Description
+            ///      Makes the simulated stream look like it is in use by someone else, for testing the callers'
+            ///      fallback to core copies.
+            ///
+            ///
+            /// @param      busy                  TRUE for the stream to be in use.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void SetSimulatedBusy( BOOL busy );
+#endif
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagMdma(const BlackfinDiagMdma &);
+
+	        const BlackfinDiagMdma & operator = (const BlackfinDiagMdma & );
+
+	        // A copy has been started and not waited on yet.
+	        BOOL                       m_CopyInProgress;
+
+	        // Counts kept of the copies done.
+	        MdmaStatistics             m_Statistics;
+
+	        // The stream is claimed for a transfer left running, shared by every user of the stream.
+	        static BOOL                m_BackgroundTransferInProgress;
+
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	        // State of the simulated stream.  The words are copied when the copy is waited on.
+	        BOOL                       m_SimulatedBusy;
+
+	        const UINT32 *             m_pSimulatedSource;
+
+	        UINT32 *                   m_pSimulatedDestination;
+
+	        UINT32                     m_SimulatedNmbrWords;
+#endif
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagMdma: IsReachableByDma
+            ///
+            /// @par Full Description
+            ///      Determines if a block of words can be reached by DMA, the L1 scratchpad can not.
+            ///
+            /// @param        pFirstWord    First word of the block.
+            ///               nmbrWords     Number of words in the block.
+            ///
+            /// @return       TRUE when the block can be reached by DMA
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsReachableByDma( const UINT32 * pFirstWord, UINT32 nmbrWords );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_MDMA_HPP)
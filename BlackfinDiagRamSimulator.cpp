@@ -0,0 +1,374 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagRamSimulator.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagRamSimulator class.
+///
+/// @see BlackfinDiagRamSimulator.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagAddress.hpp"
+#include "BlackfinDiagRamSimulator.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+    // Multiplier and increment of the linear congruential generator filling the RAM.
+    static const UINT32 FILL_LCG_MULTIPLIER = 1664525;
+    static const UINT32 FILL_LCG_INCREMENT  = 1013904223;
+
+    BlackfinDiagRamSimulator * BlackfinDiagRamSimulator::m_pActiveSimulator = NULL;
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: BlackfinDiagRamSimulator
+    ///
+    ///      Construction of a simulated RAM without faults
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BlackfinDiagRamSimulator::BlackfinDiagRamSimulator()
+        :   m_NmbrFaults              ( 0 )
+    {
+        for ( UINT32 ui = 0; ui < RAM_SIMULATOR_WORDS; ++ui )
+        {
+            m_Memory[ ui ] = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: ~BlackfinDiagRamSimulator
+    ///
+    ///      Deactivates the simulated RAM if it is active
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BlackfinDiagRamSimulator::~BlackfinDiagRamSimulator()
+    {
+        if ( this == m_pActiveSimulator )
+        {
+            m_pActiveSimulator = NULL;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: Activate
+    ///
+    ///      Makes this the simulated RAM the static accessors go through
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::Activate()
+    {
+        m_pActiveSimulator = this;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: Deactivate
+    ///
+    ///      No simulated RAM is active after
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::Deactivate()
+    {
+        m_pActiveSimulator = NULL;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: GetMemoryStart
+    ///
+    ///      Get the first byte of the simulated RAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 * BlackfinDiagRamSimulator::GetMemoryStart()
+    {
+        return reinterpret_cast<UINT8 *>( m_Memory );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: Fill
+    ///
+    ///      Fills the simulated RAM with pseudo random data and clears the faults
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::Fill( UINT32 seed )
+    {
+        ClearFaults();
+
+        UINT32 value = seed;
+
+        for ( UINT32 ui = 0; ui < RAM_SIMULATOR_WORDS; ++ui )
+        {
+            value          = ( value * FILL_LCG_MULTIPLIER ) + FILL_LCG_INCREMENT;
+
+            m_Memory[ ui ] = value;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: InjectFault
+    ///
+    ///      Injects a fault into the simulated RAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagRamSimulator::InjectFault( const RamFault & rFault )
+    {
+        if (    ( m_NmbrFaults >= RAM_SIMULATOR_MAX_FAULTS )
+             || ( rFault.m_VictimWord >= RAM_SIMULATOR_WORDS )
+             || ( rFault.m_AggressorWord >= RAM_SIMULATOR_WORDS ) )
+        {
+            return FALSE;
+        }
+
+        m_Faults[ m_NmbrFaults++ ] = rFault;
+
+        // A stuck-at cell holds the fault value from the start.
+        if ( RAM_FAULT_STUCK_AT == rFault.m_FaultModel )
+        {
+            m_Memory[ rFault.m_VictimWord ] = ( m_Memory[ rFault.m_VictimWord ] & ~rFault.m_VictimBitMask )
+                                              | ( rFault.m_FaultValue & rFault.m_VictimBitMask );
+        }
+
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: ClearFaults
+    ///
+    ///      Removes all the injected faults
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::ClearFaults()
+    {
+        m_NmbrFaults = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: ReadWord
+    ///
+    ///      Reads a word, through the active simulated RAM when the word is in it
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagRamSimulator::ReadWord( const volatile UINT32 * pWord )
+    {
+        UINT32 word = 0;
+
+        if ( ( NULL != m_pActiveSimulator ) && m_pActiveSimulator->IsSimulated( pWord, word ) )
+        {
+            return m_pActiveSimulator->ReadSimulatedWord( word );
+        }
+
+        return *pWord;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: WriteWord
+    ///
+    ///      Writes a word, through the active simulated RAM when the word is in it
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::WriteWord( volatile UINT32 * pWord, UINT32 value )
+    {
+        UINT32 word = 0;
+
+        if ( ( NULL != m_pActiveSimulator ) && m_pActiveSimulator->IsSimulated( pWord, word ) )
+        {
+            m_pActiveSimulator->WriteSimulatedWord( word, value );
+
+            return;
+        }
+
+        *pWord = value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: ReadByte
+    ///
+    ///      Reads a byte, through the active simulated RAM when the byte is in it
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 BlackfinDiagRamSimulator::ReadByte( const volatile UINT8 * pByte )
+    {
+        UINT32 word = 0;
+
+        if ( ( NULL != m_pActiveSimulator ) && m_pActiveSimulator->IsSimulated( pByte, word ) )
+        {
+            // Blackfin is little endian, the lowest addressed byte is the low byte of the word.
+            UINT32 shift = ( reinterpret_cast<AddressValue>( pByte ) & RAM_SIMULATOR_BYTE_IN_WORD_MASK )
+                           * RAM_SIMULATOR_BITS_PER_BYTE;
+
+            return static_cast<UINT8>( m_pActiveSimulator->ReadSimulatedWord( word ) >> shift );
+        }
+
+        return *pByte;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: WriteByte
+    ///
+    ///      Writes a byte, through the active simulated RAM when the byte is in it
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::WriteByte( volatile UINT8 * pByte, UINT8 value )
+    {
+        UINT32 word = 0;
+
+        if ( ( NULL != m_pActiveSimulator ) && m_pActiveSimulator->IsSimulated( pByte, word ) )
+        {
+            UINT32 shift    = ( reinterpret_cast<AddressValue>( pByte ) & RAM_SIMULATOR_BYTE_IN_WORD_MASK )
+                              * RAM_SIMULATOR_BITS_PER_BYTE;
+
+            UINT32 mask     = RAM_SIMULATOR_BYTE_MASK << shift;
+
+            UINT32 previous = m_pActiveSimulator->m_Memory[ m_pActiveSimulator->DecodeAddress( word ) ];
+
+            m_pActiveSimulator->WriteSimulatedWord( word, ( previous & ~mask ) | ( static_cast<UINT32>( value ) << shift ) );
+
+            return;
+        }
+
+        *pByte = value;
+    }
+
+    //***************************************************************************
+    // PRIVATE METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: IsSimulated
+    ///
+    ///      Determines if an address is in the simulated RAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagRamSimulator::IsSimulated( const volatile void * pAddress, UINT32 & rWord )
+    {
+        AddressValue address     = reinterpret_cast<AddressValue>( pAddress );
+
+        AddressValue memoryStart = reinterpret_cast<AddressValue>( m_Memory );
+
+        if ( ( address < memoryStart ) || ( address >= ( memoryStart + sizeof( m_Memory ) ) ) )
+        {
+            return FALSE;
+        }
+
+        rWord = static_cast<UINT32>( ( address - memoryStart ) / sizeof( UINT32 ) );
+
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: DecodeAddress
+    ///
+    ///      Applies address decoder aliases to the index of a word
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagRamSimulator::DecodeAddress( UINT32 word )
+    {
+        for ( UINT32 ui = 0; ui < m_NmbrFaults; ++ui )
+        {
+            if ( ( RAM_FAULT_ADDRESS_ALIAS == m_Faults[ ui ].m_FaultModel ) && ( word == m_Faults[ ui ].m_VictimWord ) )
+            {
+                return m_Faults[ ui ].m_AggressorWord;
+            }
+        }
+
+        return word;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: ReadSimulatedWord
+    ///
+    ///      Reads a word of the simulated RAM with the faults applied
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagRamSimulator::ReadSimulatedWord( UINT32 word )
+    {
+        word         = DecodeAddress( word );
+
+        UINT32 value = m_Memory[ word ];
+
+        for ( UINT32 ui = 0; ui < m_NmbrFaults; ++ui )
+        {
+            const RamFault & rFault = m_Faults[ ui ];
+
+            if ( ( RAM_FAULT_STUCK_AT == rFault.m_FaultModel ) && ( word == rFault.m_VictimWord ) )
+            {
+                value = ( value & ~rFault.m_VictimBitMask ) | ( rFault.m_FaultValue & rFault.m_VictimBitMask );
+            }
+        }
+
+        return value;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRamSimulator: WriteSimulatedWord
+    ///
+    ///      Writes a word of the simulated RAM with the faults applied
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRamSimulator::WriteSimulatedWord( UINT32 word, UINT32 value )
+    {
+        word            = DecodeAddress( word );
+
+        UINT32 previous = m_Memory[ word ];
+
+        for ( UINT32 ui = 0; ui < m_NmbrFaults; ++ui )
+        {
+            const RamFault & rFault = m_Faults[ ui ];
+
+            if ( word != rFault.m_VictimWord )
+            {
+                continue;
+            }
+
+            if ( RAM_FAULT_STUCK_AT == rFault.m_FaultModel )
+            {
+                value = ( value & ~rFault.m_VictimBitMask ) | ( rFault.m_FaultValue & rFault.m_VictimBitMask );
+            }
+            else if ( RAM_FAULT_TRANSITION == rFault.m_FaultModel )
+            {
+                // Faulty bits changing to the fault value keep their previous value.
+                UINT32 blocked = ( previous ^ value ) & ~( value ^ rFault.m_FaultValue ) & rFault.m_VictimBitMask;
+
+                value          = ( value & ~blocked ) | ( previous & blocked );
+            }
+        }
+
+        m_Memory[ word ] = value;
+
+        for ( UINT32 ui = 0; ui < m_NmbrFaults; ++ui )
+        {
+            const RamFault & rFault = m_Faults[ ui ];
+
+            if (    ( RAM_FAULT_COUPLING == rFault.m_FaultModel )
+                 && ( word == rFault.m_AggressorWord )
+                 && ( ( previous ^ value ) & rFault.m_AggressorBitMask ) )
+            {
+                m_Memory[ rFault.m_VictimWord ] = ( m_Memory[ rFault.m_VictimWord ] & ~rFault.m_VictimBitMask )
+                                                  | ( rFault.m_FaultValue & rFault.m_VictimBitMask );
+            }
+        }
+    }
+
+}
+
+#endif // defined(BLACKFIN_DIAG_HOST_BUILD)
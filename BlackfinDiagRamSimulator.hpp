@@ -0,0 +1,336 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagRamSimulator.hpp
+///
+/// Namespace for the simulated RAM the data RAM test is run against on a Linux host
+///
+/// @par Full Description
+///
+/// Only built with BLACKFIN_DIAG_HOST_BUILD defined.  The simulated RAM is an array of 32 bit words the data RAM test
+/// regions are pointed at.  While the simulator is active the test reads and writes the array through ReadWord,
+/// WriteWord, ReadByte and WriteByte, the C++ reference versions of the assembly language kernels do too.  Faults
+/// injected into the array change what those reads and writes see:
+///
+///     stuck-at                 the faulty bits always read as the fault value
+///     transition               the faulty bits can not change to the fault value
+///     coupling                 a change of the aggressor bits forces the faulty bits to the fault value
+///     address decoder alias    accesses to the faulty word reach the aggressor word instead
+///
+/// Addresses outside the array are read and written directly.  The host build is native, normally 64 bit, so
+/// addresses are compared as AddressValue, uintptr_t there, see BlackfinDiagAddress.hpp.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_RAM_SIMULATOR_HPP)
+#define BLACKFIN_DIAG_RAM_SIMULATOR_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+// C++ PROJECT INCLUDES
+// (none)
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 RAM_SIMULATOR_WORDS         = 0x2000;      // 32K bytes, the size of data bank A
+    static const UINT32 RAM_SIMULATOR_MAX_FAULTS    = 4;
+    static const UINT32 RAM_SIMULATOR_BITS_PER_BYTE = 8;
+    static const UINT32 RAM_SIMULATOR_BYTE_MASK     = 0xff;
+    static const UINT32 RAM_SIMULATOR_BYTE_IN_WORD_MASK = 0x3;
+
+    class BlackfinDiagRamSimulator
+    {
+        public:
+
+            // Fault models that can be injected.
+            typedef enum
+            {
+                RAM_FAULT_STUCK_AT = 0,
+                RAM_FAULT_TRANSITION,
+                RAM_FAULT_COUPLING,
+                RAM_FAULT_ADDRESS_ALIAS,
+                NUMBER_OF_RAM_FAULT_MODELS
+            }
+            RamFaultModels;
+
+            // A fault injected into the simulated RAM.  Words are indexes into the array.
+            typedef struct
+            {
+                RamFaultModels   m_FaultModel;
+                UINT32           m_VictimWord;          // Word with the fault
+                UINT32           m_VictimBitMask;       // Faulty bits of the word, not used for an alias
+                UINT32           m_FaultValue;          // Stuck-at, transition to, or coupled value of the faulty bits
+                UINT32           m_AggressorWord;       // Coupling word, or the word an alias reaches instead
+                UINT32           m_AggressorBitMask;    // Coupling bits of the aggressor word
+            }
+            RamFault;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: BlackfinDiagRamSimulator
+            ///
+            /// @par Full Description
+            ///      Construction of a simulated RAM without faults, filled with zeros and not active.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           Simulated RAM instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagRamSimulator();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: ~BlackfinDiagRamSimulator
+            ///
+            /// @par Full Description
+            ///      Deactivates the simulated RAM if it is active.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        ~BlackfinDiagRamSimulator();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: Activate
+            ///
+            /// @par Full Description
+            ///      Makes this the simulated RAM the static accessors go through.  Only one is active at a time.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void Activate();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: Deactivate
+            ///
+            /// @par Full Description
+            ///      No simulated RAM is active after, the static accessors access memory directly.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void Deactivate();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: GetMemoryStart
+            ///
+            /// @par Full Description
+            ///      Get the first byte of the simulated RAM, for pointing data RAM test regions at.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           First byte of the simulated RAM
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT8 * GetMemoryStart();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: Fill
+            ///
+            /// @par Full Description
+            ///      Fills the simulated RAM with pseudo random data standing in for live data and clears the faults.
+            ///
+            ///
+            /// @param      seed                  Seed of the pseudo random data, the same seed gives the same data.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void Fill( UINT32 seed );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: InjectFault
+            ///
+            /// @par Full Description
+            ///      Injects a fault into the simulated RAM.
+            ///
+            ///
+            /// @param      rFault                The fault to inject.
+            ///
+            /// @return                           FALSE when the fault is outside the array or too many are injected
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL InjectFault( const RamFault & rFault );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: ClearFaults
+            ///
+            /// @par Full Description
+            ///      Removes all the injected faults.
+            ///
+            ///
+            /// @param                            None
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ClearFaults();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: ReadWord
+            ///
+            /// @par Full Description
+            ///      Reads a word, through the active simulated RAM when the word is in it.
+            ///
+            ///
+            /// @param      pWord                 Word to read.
+            ///
+            /// @return                           Value read
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static UINT32 ReadWord( const volatile UINT32 * pWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: WriteWord
+            ///
+            /// @par Full Description
+            ///      Writes a word, through the active simulated RAM when the word is in it.
+            ///
+            ///
+            /// @param      pWord                 Word to write.
+            ///             value                 Value to write.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static void WriteWord( volatile UINT32 * pWord, UINT32 value );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: ReadByte
+            ///
+            /// @par Full Description
+            ///      Reads a byte, through the active simulated RAM when the byte is in it.
+            ///
+            ///
+            /// @param      pByte                 Byte to read.
+            ///
+            /// @return                           Value read
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static UINT8 ReadByte( const volatile UINT8 * pByte );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: WriteByte
+            ///
+            /// @par Full Description
+            ///      Writes a byte, through the active simulated RAM when the byte is in it.  The other bytes of the
+            ///      word are written back unchanged.
+            ///
+            ///
+            /// @param      pByte                 Byte to write.
+            ///             value                 Value to write.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        static void WriteByte( volatile UINT8 * pByte, UINT8 value );
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagRamSimulator(const BlackfinDiagRamSimulator &);
+
+	        const BlackfinDiagRamSimulator & operator = (const BlackfinDiagRamSimulator & );
+
+	        // The simulated RAM.
+	        UINT32                     m_Memory[ RAM_SIMULATOR_WORDS ];
+
+	        // Faults injected.
+	        RamFault                   m_Faults[ RAM_SIMULATOR_MAX_FAULTS ];
+
+	        UINT32                     m_NmbrFaults;
+
+	        // Simulated RAM the static accessors go through, NULL for none.
+	        static BlackfinDiagRamSimulator * m_pActiveSimulator;
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: IsSimulated
+            ///
+            /// @par Full Description
+            ///      Determines if an address is in the simulated RAM.
+            ///
+            /// @param        pAddress      Address to check.
+            ///               rWord         Set to the index of the word holding the address.
+            ///
+            /// @return       TRUE when the address is in the simulated RAM
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsSimulated( const volatile void * pAddress, UINT32 & rWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: DecodeAddress
+            ///
+            /// @par Full Description
+            ///      Applies address decoder aliases to the index of a word.
+            ///
+            /// @param        word          Index of the word accessed.
+            ///
+            /// @return       Index of the word reached
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32 DecodeAddress( UINT32 word );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: ReadSimulatedWord
+            ///
+            /// @par Full Description
+            ///      Reads a word of the simulated RAM with the faults applied.
+            ///
+            /// @param        word          Index of the word.
+            ///
+            /// @return       Value read
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32 ReadSimulatedWord( UINT32 word );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRamSimulator: WriteSimulatedWord
+            ///
+            /// @par Full Description
+            ///      Writes a word of the simulated RAM with the faults applied.
+            ///
+            /// @param        word          Index of the word.
+            ///               value         Value to write.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void WriteSimulatedWord( UINT32 word, UINT32 value );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_RAM_SIMULATOR_HPP)
@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagReadOnlyData.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagReadOnlyData class.
+///
+/// @see BlackfinDiagReadOnlyData.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Os_iotk.h"             // This file depends on Defs.h.  It should include that file
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagReadOnlyData.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+    const UINT32 BlackfinDiagReadOnlyData::CRC32_NIBBLE_TABLE[] =
+                                           {
+                                               0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+                                               0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+                                               0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+                                               0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+                                           };
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: RunTest
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+    ///      this method to run iterations of the diagnostic test.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    DiagnosticTesting::DiagnosticTest::TestState BlackfinDiagReadOnlyData::RunTest( UINT32 & rErrorCode )
+    {
+	    ConfigForAnyNewDiagCycle( this );
+
+		DiagnosticTesting::DiagnosticTest::TestState ts = DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+
+	    for ( UINT32 ui = 0; ui < m_NmbrReadOnlyRegions; ++ui )
+	    {
+	        ReadOnlyRegionDescriptor * pRegion = &m_pReadOnlyRegions[ ui ];
+
+	        if ( pRegion->m_CheckCompleted )
+	        {
+	            continue;
+	        }
+
+		    if ( !CheckRegion( pRegion ) )
+		    {
+		 	    EncodeErrorInfo( rErrorCode, ui + 1, pRegion->m_CrcSoFar );
+
+		 	    OS_Assert( rErrorCode );
+		    }
+
+		    ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
+
+		    break;
+	    }
+
+	   return ts;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: CheckRegion
+    ///
+    ///      Adds an "iteration" amount of a region to its CRC and checks the CRC when the region is done
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagReadOnlyData::CheckRegion( ReadOnlyRegionDescriptor * pRegion )
+    {
+	    UINT32 nmbrBytesToCheckThisIteration = pRegion->m_NmbrBytesToCheck - pRegion->m_NmbrBytesChecked;
+
+	    if ( nmbrBytesToCheckThisIteration > m_NmbrBytesToCheckPerIteration )
+	    {
+		    nmbrBytesToCheckThisIteration = m_NmbrBytesToCheckPerIteration;
+	    }
+
+	    pRegion->m_CrcSoFar          = UpdateCrc( pRegion->m_CrcSoFar,
+	                                              pRegion->m_pRegionStart + pRegion->m_NmbrBytesChecked,
+	                                              nmbrBytesToCheckThisIteration );
+
+	    pRegion->m_NmbrBytesChecked += nmbrBytesToCheckThisIteration;
+
+	    if ( pRegion->m_NmbrBytesChecked < pRegion->m_NmbrBytesToCheck )
+	    {
+	        return TRUE;
+	    }
+
+	    pRegion->m_CheckCompleted    = TRUE;
+
+	    pRegion->m_CrcSoFar         ^= CRC32_FINAL_XOR;
+
+	    return ( pRegion->m_CrcSoFar == pRegion->m_GoldenCrc );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: ComputeGoldenCrcs
+    ///
+    ///      Computes the golden CRC of each region whose golden CRC is not known, in one pass over the region
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagReadOnlyData::ComputeGoldenCrcs()
+    {
+	    for ( UINT32 ui = 0; ui < m_NmbrReadOnlyRegions; ++ui )
+	    {
+	        ReadOnlyRegionDescriptor * pRegion = &m_pReadOnlyRegions[ ui ];
+
+	        if ( pRegion->m_GoldenCrcKnown )
+	        {
+	            continue;
+	        }
+
+	        pRegion->m_GoldenCrc      = UpdateCrc( CRC32_INITIAL_VALUE,
+	                                               pRegion->m_pRegionStart,
+	                                               pRegion->m_NmbrBytesToCheck ) ^ CRC32_FINAL_XOR;
+
+	        pRegion->m_GoldenCrcKnown = TRUE;
+	    }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: UpdateCrc
+    ///
+    ///      Adds bytes to a CRC-32 computed so far, a nibble at a time
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 BlackfinDiagReadOnlyData::UpdateCrc( UINT32 crc, const UINT8 * pFirstByte, UINT32 nmbrBytes )
+    {
+        for ( UINT32 ui = 0; ui < nmbrBytes; ++ui )
+        {
+            UINT32 byte = pFirstByte[ ui ];
+
+            crc = ( crc >> CRC32_BITS_PER_NIBBLE ) ^ CRC32_NIBBLE_TABLE[ ( crc ^ byte ) & CRC32_NIBBLE_MASK ];
+
+            crc = ( crc >> CRC32_BITS_PER_NIBBLE )
+                  ^ CRC32_NIBBLE_TABLE[ ( crc ^ ( byte >> CRC32_BITS_PER_NIBBLE ) ) & CRC32_NIBBLE_MASK ];
+        }
+
+        return crc;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: EncodeErrorInfo
+    ///
+    ///      Encoding information about a test failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagReadOnlyData::EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 regionNumber, UINT32 crc )
+    {
+        rErrorInfo  = GetTestType() << DIAG_ERROR_TYPE_BIT_POS;
+
+        rErrorInfo |= regionNumber << READ_ONLY_REGION_FAILURE_BIT_POS;
+
+        // The golden CRC is in the descriptor.
+        rErrorInfo |= crc & READ_ONLY_CRC_ERROR_MASK;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagReadOnlyData: ConfigureForNextTestCycle
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class. This method is called
+    ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+    ///      initialized for an individual test is initialized.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagReadOnlyData::ConfigureForNextTestCycle()
+    {
+	    for ( UINT32 ui = 0; ui < m_NmbrReadOnlyRegions; ++ui )
+	    {
+	        m_pReadOnlyRegions[ ui ].m_CheckCompleted   = FALSE;
+
+	        m_pReadOnlyRegions[ ui ].m_NmbrBytesChecked = 0;
+
+	        m_pReadOnlyRegions[ ui ].m_CrcSoFar         = CRC32_INITIAL_VALUE;
+	    }
+    }
+
+}
@@ -0,0 +1,219 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagReadOnlyData.hpp
+///
+/// Namespace for the read only data diagnostic test
+///
+/// @par Full Description
+///
+/// Diagnostic testing for memory regions that never change after boot, like the constant tables in L1 data memory
+/// and external memory.  Nothing is written to them, a CRC-32 is computed over each region a number of bytes per
+/// iteration and compared to the region's golden CRC when the whole region has been read.  The golden CRC is either
+/// known at build time or computed over the whole region in one pass when the test is constructed at boot.  A
+/// mismatch is reported as an error.  A computed golden CRC is only as good as the region was at boot, so regions
+/// that have to be covered from before then need their golden CRC known at build time.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_READ_ONLY_DATA_HPP)
+#define BLACKFIN_DIAG_READ_ONLY_DATA_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+// (none)
+
+// C++ PROJECT INCLUDES
+#include "DiagnosticTesting.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 READ_ONLY_REGION_FAILURE_BIT_POS = 16;          // Region number, 1 for the first region
+    static const UINT32 READ_ONLY_CRC_ERROR_MASK        = 0xffff;      // Low half of the CRC computed
+    static const UINT32 CRC32_INITIAL_VALUE             = 0xffffffff;
+    static const UINT32 CRC32_FINAL_XOR                 = 0xffffffff;
+    static const UINT32 CRC32_NIBBLE_MASK               = 0xf;
+    static const UINT32 CRC32_BITS_PER_NIBBLE           = 4;
+
+    class BlackfinDiagReadOnlyData : public DiagnosticTesting::DiagnosticTest
+    {
+        public:
+
+            // For read only memory regions
+            typedef struct
+            {
+    	        const UINT8 *    m_pRegionStart;
+    	        UINT32           m_NmbrBytesToCheck;
+    	        UINT32           m_GoldenCrc;           // Expected CRC of the region
+    	        BOOL             m_GoldenCrcKnown;      // FALSE to compute the golden CRC when the test is constructed
+    	        UINT32           m_NmbrBytesChecked;
+    	        UINT32           m_CrcSoFar;
+    	        BOOL             m_CheckCompleted;
+            }
+            ReadOnlyRegionDescriptor;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: BlackfinDiagReadOnlyData
+            ///
+            /// @par Full Description
+            ///      Construction that is used to construct the BlackfinDiagReadOnlyData object that is used to check
+            ///      read only data.  It is derived from the DiagnosticTesting::DiagnosticTest base class.  The golden
+            ///      CRC of each region not known at build time is computed here, in one pass over the region.
+            ///
+            /// @param pReadOnlyRegions             Array of the read only memory regions to check, checked in order.
+            ///        nmbrReadOnlyRegions          Number of regions in the array, at most 0x3ff.
+            ///        nmbrBytesToCheckPerIteration Number of bytes to read per iteration of the test.
+            ///        ExecuteTestData              Initial runtime data passed to the base for running this test.
+            ///
+            /// @return                             Blackfin read only data diagnostic instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagReadOnlyData( ReadOnlyRegionDescriptor * pReadOnlyRegions,
+	                                  UINT32                     nmbrReadOnlyRegions,
+	                                  UINT32                     nmbrBytesToCheckPerIteration,
+		    		                  DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData )
+						         :  DiagnosticTesting::DiagnosticTest ( rTestData ),
+	                       	        m_pReadOnlyRegions                ( pReadOnlyRegions ),
+	                       	        m_NmbrReadOnlyRegions             ( nmbrReadOnlyRegions ),
+	                       	        m_NmbrBytesToCheckPerIteration    ( nmbrBytesToCheckPerIteration )
+	        {
+	            ComputeGoldenCrcs();
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: RunTest
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+            ///      this method to run iterations of the diagnostic test.
+            ///
+            ///
+            /// @param                            Reference to a possible error code returned from the scheduler.
+            ///
+            /// @return                           Status of executing a test
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        DiagnosticTest::TestState RunTest( UINT32 & rErrorCode  );
+
+        protected:
+
+	        //***************************************************************************
+            // PROTECTED METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: ConfigureForNextTestCycle
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class. This method is called
+            ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+            ///      initialized for an individual test is initialized.
+            ///
+            /// @param                            None.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ConfigureForNextTestCycle();
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagReadOnlyData(const BlackfinDiagReadOnlyData &);
+
+	        const BlackfinDiagReadOnlyData & operator = (const BlackfinDiagReadOnlyData & );
+
+            BlackfinDiagReadOnlyData();
+
+            // Descriptors for checking individual memory regions.
+            ReadOnlyRegionDescriptor * m_pReadOnlyRegions;
+
+            UINT32                     m_NmbrReadOnlyRegions;
+
+	        // Number of bytes to check per iteration of the test.
+	        UINT32                     m_NmbrBytesToCheckPerIteration;
+
+	        // CRC-32 of each value of a nibble, reflected polynomial 0xedb88320.
+	        static const UINT32        CRC32_NIBBLE_TABLE[];
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: CheckRegion
+            ///
+            /// @par Full Description
+            ///      Adds an "iteration" amount of a region to its CRC.  When the whole region has been read the CRC is
+            ///      compared to the golden CRC.
+            ///
+            /// @param        pRegion        Check information about the region being checked.
+            ///
+            /// @return       TRUE when the check passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL CheckRegion( ReadOnlyRegionDescriptor * pRegion );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: ComputeGoldenCrcs
+            ///
+            /// @par Full Description
+            ///      Computes the golden CRC of each region whose golden CRC is not known, in one pass over the region.
+            ///
+            /// @param                            None.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ComputeGoldenCrcs();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: UpdateCrc
+            ///
+            /// @par Full Description
+            ///      Adds bytes to a CRC-32 computed so far.
+            ///
+            /// @param        crc            CRC of the bytes before, CRC32_INITIAL_VALUE for none.
+            ///               pFirstByte     First byte to add.
+            ///               nmbrBytes      Number of bytes to add.
+            ///
+            /// @return       CRC including the bytes, before the final exclusive or
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32 UpdateCrc( UINT32 crc, const UINT8 * pFirstByte, UINT32 nmbrBytes );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagReadOnlyData: EncodeErrorInfo
+            ///
+            /// @par Full Description
+            ///      Encoding information about a test failure
+            ///
+            /// @param        rErrorInfo          A reference for passing back error info to the caller.
+            ///               regionNumber        The region where the failure occurred, 1 for the first region.
+            ///               crc                 The CRC computed for the region
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 regionNumber, UINT32 crc );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_READ_ONLY_DATA_HPP)
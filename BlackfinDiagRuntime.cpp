@@ -32,16 +32,93 @@
 #include "BlackfinDiagRegistersTest.hpp"
 #include "BlackfinDiagTimerTest.hpp"
 #include "BlackfinDiagInstructionsTest.hpp"
+#include "BlackfinDiagReadOnlyData.hpp"
+#include "BlackfinDiagSdram.hpp"
+#include "BlackfinDiagUnusedStack.hpp"
 
 
 namespace BlackfinDiagRuntimeEnvironment 
 {
+    //
+    // Bounds of the data RAM regions tested.  The .ldf file defines a start and a length for each region, for 
+    // example:
+    //
+    //     ldf_l1_data_a_start  = MEMORY_START( MEM_L1_DATA_A );
+    //     ldf_l1_data_a_length = MEMORY_SIZEOF( MEM_L1_DATA_A );
+    //
+    // A length is the address of its symbol.
+    //
+    extern UINT8 ldf_l1_data_a_start          asm("ldf_l1_data_a_start");
+    extern UINT8 ldf_l1_data_a_length         asm("ldf_l1_data_a_length");
+    extern UINT8 ldf_l1_data_a_cache_start    asm("ldf_l1_data_a_cache_start");
+    extern UINT8 ldf_l1_data_a_cache_length   asm("ldf_l1_data_a_cache_length");
+    extern UINT8 ldf_l1_data_b_start          asm("ldf_l1_data_b_start");
+    extern UINT8 ldf_l1_data_b_length         asm("ldf_l1_data_b_length");
+    extern UINT8 ldf_l1_data_b_cache_start    asm("ldf_l1_data_b_cache_start");
+    extern UINT8 ldf_l1_data_b_cache_length   asm("ldf_l1_data_b_cache_length");
+    extern UINT8 ldf_l1_scratchpad_start      asm("ldf_l1_scratchpad_start");
+    extern UINT8 ldf_l1_scratchpad_length     asm("ldf_l1_scratchpad_length");
+    
+    // Count of bad interrupts kept by the OS in the scratchpad.  The NMI and exception handlers update it, those can
+    // not be disabled so it is never tested.
+    extern "C" USINT dummy_isr_count;
+    
+    //
+    // Bounds of the read only data checked, the constant data the .ldf file places in L1 data memory and in external
+    // memory, for example:
+    //
+    //     ldf_l1_constdata_start  = .;   INPUT_SECTIONS( $OBJECTS(constdata) )   ldf_l1_constdata_end = .;
+    //     ldf_l1_constdata_length = ldf_l1_constdata_end - ldf_l1_constdata_start;
+    //
+    extern UINT8 ldf_l1_constdata_start       asm("ldf_l1_constdata_start");
+    extern UINT8 ldf_l1_constdata_length      asm("ldf_l1_constdata_length");
+    extern UINT8 ldf_sdram_constdata_start    asm("ldf_sdram_constdata_start");
+    extern UINT8 ldf_sdram_constdata_length   asm("ldf_sdram_constdata_length");
+
+    //
+    // Bounds of the external SDRAM tested, only the data section the .ldf file sets aside in SDRAM for data the test 
+    // can save, overwrite and restore.  Code, the heap, the constant data and buffers peripherals write by DMA are 
+    // placed outside it, for example:
+    //
+    //     ldf_sdram_data_start  = .;   INPUT_SECTIONS( $OBJECTS(sdram_data) )   ldf_sdram_data_end = .;
+    //     ldf_sdram_data_length = ldf_sdram_data_end - ldf_sdram_data_start;
+    //
+    extern UINT8 ldf_sdram_data_start         asm("ldf_sdram_data_start");
+    extern UINT8 ldf_sdram_data_length        asm("ldf_sdram_data_length");
+
+    // Scheduler is created on the first call to ExecuteDiagnostics.
+    static BlackfinDiagSchedule * pSchedule;
 
     extern "C" void RunDiagnostics() 
     {
 	    BlackfinDiagRuntimeEnvironment::BlackfinDiagRuntime::ExecuteDiagnostics();
     }
 
+    extern "C" void PauseMemoryDiagnostics() 
+    {
+	    BlackfinDiagRuntimeEnvironment::BlackfinDiagRuntime::PauseMemoryDiagnostics();
+    }
+
+    extern "C" void ResumeMemoryDiagnostics() 
+    {
+	    BlackfinDiagRuntimeEnvironment::BlackfinDiagRuntime::ResumeMemoryDiagnostics();
+    }
+
+    extern "C" BOOL GetSchedulerStatistics( BlackfinDiagSchedule::SchedulerStatistics * pStatistics ) 
+    {
+        if ( NULL == pStatistics ) 
+        {
+            return FALSE;
+        }
+        
+	    return BlackfinDiagRuntimeEnvironment::BlackfinDiagRuntime::GetSchedulerStatistics( *pStatistics );
+    }
+
+    extern "C" void ResetSchedulerStatistics() 
+    {
+	    BlackfinDiagRuntimeEnvironment::BlackfinDiagRuntime::ResetSchedulerStatistics();
+    }
+
     static void BlackfinCrash( INT errorCode )
     {
         OS_Assert( errorCode );
@@ -82,6 +159,31 @@ namespace BlackfinDiagRuntimeEnvironment
 	    return timestamp;
 	}
 	
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRuntime: IsSystemIdle
+    ///
+    /// @par Full Description
+    ///      Method scheduler uses to determine if the system has been idle since the last time it asked.  The 
+    ///      OS counts every reschedule so if the count has not changed no other task has needed the processor.
+    ///      
+    ///
+    ///                               
+    /// @return                             TRUE when no task has been rescheduled since the previous call.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	static BOOL IsSystemIdle () 
+	{
+	    static UDINT lastRescheduleCount;
+	    
+	    UDINT        rescheduleCount = os_reschedule_counter;
+	    
+	    BOOL         idle            = ( rescheduleCount == lastRescheduleCount );
+	       
+	    lastRescheduleCount = rescheduleCount;
+	        
+	    return idle;
+	}
+	
     //
     // Default initial values for diagnostic data.
     //
@@ -89,6 +191,9 @@ namespace BlackfinDiagRuntimeEnvironment
     static const UINT32  DFLT_INITIAL_ELAPSED_TIME            = 0;          
     static const UINT32  DFLT_NBR_TIMES_TO_RUN_PER_DIAG_CYCLE = 1; 
     static const UINT32  DFLT_NBR_TIMES_RAN_THIS_DIAG_CYCLE   = 0;
+    static const UINT32  DFLT_INITIAL_TIME_PAUSED             = 0;
+    static const UINT32  DFLT_MAX_ITERATIONS_PER_BATCH        = 1;
+    static const UINT32  DFLT_NO_PREREQUISITE_TEST_TYPES      = 0;
 
 
     //***************************************************************************
@@ -113,11 +218,20 @@ namespace BlackfinDiagRuntimeEnvironment
     { 
         static BOOL Initialized;  // FALSE by default but why not
     
-        static DiagnosticScheduling::DiagnosticScheduler<DiagnosticTesting::DiagnosticTest> * pSchedule;
-    
         if ( !Initialized ) 
         {
 
+            //
+            // The memory tests rely on working registers so they are held each diagnostic cycle until the register 
+            // test has passed.
+            //
+            static const UINT32 MEMORY_TEST_PREREQUISITE_TEST_TYPES = ( 1 << DiagnosticTesting::DiagnosticTest::DIAG_REGISTER_TEST_TEST_TYPE );
+
+            //
+            // Requirement:  All Diagnostic Tests Complete in 4 Hours.
+            //
+            static const UINT32 PERIOD_FOR_ALL_DIAGNOSTICS_COMPLETED_MS     = 2 * 60 * 60 * 1000; // 2 hours for now, number of milleseconds in 4 hours
+
             //***********************************************************************************************************
             //                                                                                                          *
             // Data RAM testing parameters, structures and definitions.                                                 *
@@ -126,10 +240,14 @@ namespace BlackfinDiagRuntimeEnvironment
 
             static const UINT32 NMBR_DATA_RAM_BYTES_TESTED_PER_ITERATION = 0x400; // Test 1k at a time for now
             static const UINT32 DATA_RAM_TEST_ITERATION_PERIOD_MS        = 1000; // 1 second for now
+            static const UINT32 DATA_RAM_TEST_MAX_ITERATIONS_PER_BATCH   = 16;   // Up to 16k at a time when idle
+            static const UINT32 DATA_RAM_MAX_CRITICAL_SECTION_CYCLES     = US_TO_CCLK( 10 );  // Apex ISR latency bound
 
-            static UINT8 DATA_RAM_TEST_TEST_PATTERNS[]  = 
+            static UINT32 DATA_RAM_TEST_TEST_PATTERNS[]  = 
                                                     { 
-                                                        0xff,0, 0x55, 0xaa, 0xf, 0xf0, 0xa0, 0xa, 0x50, 0x5, 0x5a, 0xa5 
+                                                        0xffffffff, 0,          0x55555555, 0xaaaaaaaa, 
+                                                        0x0f0f0f0f, 0xf0f0f0f0, 0xa0a0a0a0, 0x0a0a0a0a, 
+                                                        0x50505050, 0x05050505, 0x5a5a5a5a, 0xa5a5a5a5 
                                                     };
 
 
@@ -145,48 +263,317 @@ namespace BlackfinDiagRuntimeEnvironment
                                                                     DFLT_NBR_TIMES_TO_RUN_PER_DIAG_CYCLE,
                                                                     DFLT_NBR_TIMES_RAN_THIS_DIAG_CYCLE,
                                                                     DiagnosticTesting::DiagnosticTest::DIAG_NO_TEST_TYPE,
-                                                                    DiagnosticTesting::DiagnosticTest::TEST_IDLE
+                                                                    DiagnosticTesting::DiagnosticTest::TEST_IDLE,
+                                                                    FALSE,
+                                                                    DFLT_INITIAL_TIMESTAMP,
+                                                                    DFLT_INITIAL_TIME_PAUSED,
+                                                                    DFLT_INITIAL_TIME_PAUSED,
+                                                                    DFLT_MAX_ITERATIONS_PER_BATCH,
+                                                                    DFLT_NO_PREREQUISITE_TEST_TYPES
                                                                 };	
 
         
             execTestData.m_IterationPeriod                   = DATA_RAM_TEST_ITERATION_PERIOD_MS;
        		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_DATA_RAM_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = DATA_RAM_TEST_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
  
 											
-            // Data ram memory regions tested
-            BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamTestDescriptor BANK_A =
+            // Data ram memory regions tested, bounds come from the .ldf file.  Banks A and B are marched, the SRAM and 
+            // the cache capable part of each are separate regions.  Bank C is tested by its own test below.  Chunks are
+            // tested in bit reversed order so a fault anywhere in a region is found early in a diagnostic cycle on 
+            // average.  The cache capable parts are skipped while DMEM_CONTROL has them configured as cache.  L1 memory
+            // is never held in the data cache so no region flushes cache lines.
+            static BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamTestDescriptor DATA_RAM_REGIONS[] =
                     { 
-    				   reinterpret_cast<UINT8 *>(0xff800000), 
-    				   0x8000, 
-    				   0, 
-    				   FALSE 
-    				}; // Bank A
-
-    		BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamTestDescriptor BANK_B =
-                    { 
-    				   reinterpret_cast<UINT8 *>(0xff900000), 
-    				   0x8000, 
-    				   0, 
-    				   FALSE 
-    				}; // Bank B
-                                                                             
-            BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamTestDescriptor BANK_C =
-                    { 
-    				   reinterpret_cast<UINT8 *>(0xffb00000), 
-    				   0x1000, 
-    				   0, 
-    				   FALSE 
-    				}; // Bank C
+                        { 
+    				        &ldf_l1_data_a_start, 
+    				        reinterpret_cast<UINT32>( &ldf_l1_data_a_length ), 
+    				        0, 
+    				        FALSE,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_MARCH_C_MINUS,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_BIT_REVERSED_CHUNKS,
+    				        FALSE,
+    				        0
+    				    }, // Bank A SRAM
+                        { 
+    				        &ldf_l1_data_a_cache_start, 
+    				        reinterpret_cast<UINT32>( &ldf_l1_data_a_cache_length ), 
+    				        0, 
+    				        FALSE,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_MARCH_C_MINUS,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_BIT_REVERSED_CHUNKS,
+    				        FALSE,
+    				        0
+    				    }, // Bank A SRAM/Cache
+                        { 
+    				        &ldf_l1_data_b_start, 
+    				        reinterpret_cast<UINT32>( &ldf_l1_data_b_length ), 
+    				        0, 
+    				        FALSE,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_MARCH_C_MINUS,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_BIT_REVERSED_CHUNKS,
+    				        FALSE,
+    				        0
+    				    }, // Bank B SRAM
+                        { 
+    				        &ldf_l1_data_b_cache_start, 
+    				        reinterpret_cast<UINT32>( &ldf_l1_data_b_cache_length ), 
+    				        0, 
+    				        FALSE,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_MARCH_C_MINUS,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_BIT_REVERSED_CHUNKS,
+    				        FALSE,
+    				        0
+    				    }  // Bank B SRAM/Cache
+    				};
+    				
+    		// Live data in the data ram memory regions that can change while interrupts are disabled.  The constant 
+    		// data is checked by the read only data test.
+            static const BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamExclusionRange DATA_RAM_EXCLUSIONS[] =
+                    {
+                        { 
+                            reinterpret_cast<UINT8 *>( &dummy_isr_count ), 
+                            sizeof( dummy_isr_count ) 
+                        }, // Updated by the NMI and exception handlers
+                        {
+                            BlackfinDiagnosticTesting::BlackfinDiagInstructionRam::GetReadBuffers(),
+                            BlackfinDiagnosticTesting::READ_BFRS_SZ
+                        }, // Written by memory DMA between iterations of the instruction RAM test
+                        {
+                            &ldf_l1_constdata_start,
+                            reinterpret_cast<UINT32>( &ldf_l1_constdata_length )
+                        }  // Constant data in L1 data memory
+                    };
                                                                         
             // Create DataRamTest object. Refer to BlackfinDataRam.hpp and BlackfinDataRam.cpp for a description
-            static BlackfinDiagnosticTesting::BlackfinDiagDataRam m_DataRamTest(  BANK_A, 
-                                                                                  BANK_B,
-                                                                                  BANK_C, 
+            static BlackfinDiagnosticTesting::BlackfinDiagDataRam m_DataRamTest(  DATA_RAM_REGIONS, 
+                                                                                  ( sizeof( DATA_RAM_REGIONS ) 
+                                                                                      / sizeof( DATA_RAM_REGIONS[ 0 ] ) ),
+                                                                                  DATA_RAM_EXCLUSIONS,
+                                                                                  ( sizeof( DATA_RAM_EXCLUSIONS ) 
+                                                                                      / sizeof( DATA_RAM_EXCLUSIONS[ 0 ] ) ),
                                                                                   DATA_RAM_TEST_TEST_PATTERNS, 
-                                                                                  ( sizeof( DATA_RAM_TEST_TEST_PATTERNS ) / sizeof( UINT8 ) ), 
+                                                                                  ( sizeof( DATA_RAM_TEST_TEST_PATTERNS ) / sizeof( UINT32 ) ), 
                                                                                   NMBR_DATA_RAM_BYTES_TESTED_PER_ITERATION,
+                                                                                  DATA_RAM_MAX_CRITICAL_SECTION_CYCLES,
                                                                                   execTestData ); 
+
+            //***********************************************************************************************************
+            //                                                                                                          *
+            // Critical data RAM testing parameters, structures and definitions.                                        *
+            //                                                                                                          *
+            //***********************************************************************************************************
+
+            //
+            // Bank C, the scratchpad, is small and holds the OS data and the stack, so it has its own test with its own
+            // cadence.  The scheduler interleaves its iterations with those of banks A and B and runs it a number of 
+            // times each diagnostic cycle.  It is tested a block at a time, each block is saved, tested and restored 
+            // with interrupts disabled.  Blocks near the stack the test runs on are tested one word at a time.
+            //
+            static const UINT32 NMBR_CRITICAL_DATA_RAM_BYTES_TESTED_PER_ITERATION = 0x100;
+            static const UINT32 CRITICAL_DATA_RAM_TEST_ITERATION_PERIOD_MS        = 100;
+            static const UINT32 CRITICAL_DATA_RAM_TEST_TIMES_TO_RUN_PER_DIAG_CYCLE = 8;
+
+            static UINT32 CRITICAL_DATA_RAM_TEST_PATTERNS[]  = 
+                                                    { 
+                                                        0xffffffff, 0,          0x55555555, 0xaaaaaaaa 
+                                                    };
+
+            execTestData.m_IterationPeriod                   = CRITICAL_DATA_RAM_TEST_ITERATION_PERIOD_MS;
+       		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_CRITICAL_DATA_RAM_TEST_TYPE;
+            execTestData.m_NmbrTimesToRunPerDiagCycle        = CRITICAL_DATA_RAM_TEST_TIMES_TO_RUN_PER_DIAG_CYCLE;
+            execTestData.m_MaxIterationsPerBatch             = DFLT_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
+
+            static BlackfinDiagnosticTesting::BlackfinDiagDataRam::DataRamTestDescriptor CRITICAL_DATA_RAM_REGIONS[] =
+                    { 
+                        { 
+    				        &ldf_l1_scratchpad_start, 
+    				        reinterpret_cast<UINT32>( &ldf_l1_scratchpad_length ), 
+    				        0, 
+    				        FALSE,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_SAVE_RESTORE_BLOCK_TEST,
+    				        BlackfinDiagnosticTesting::BlackfinDiagDataRam::DATA_RAM_BIT_REVERSED_CHUNKS,
+    				        FALSE,
+    				        0
+    				    }  // Bank C
+    				};
+
+            static BlackfinDiagnosticTesting::BlackfinDiagDataRam m_CriticalDataRamTest(  CRITICAL_DATA_RAM_REGIONS, 
+                                                                                          ( sizeof( CRITICAL_DATA_RAM_REGIONS ) 
+                                                                                              / sizeof( CRITICAL_DATA_RAM_REGIONS[ 0 ] ) ),
+                                                                                          DATA_RAM_EXCLUSIONS,
+                                                                                          ( sizeof( DATA_RAM_EXCLUSIONS ) 
+                                                                                              / sizeof( DATA_RAM_EXCLUSIONS[ 0 ] ) ),
+                                                                                          CRITICAL_DATA_RAM_TEST_PATTERNS, 
+                                                                                          ( sizeof( CRITICAL_DATA_RAM_TEST_PATTERNS ) / sizeof( UINT32 ) ), 
+                                                                                          NMBR_CRITICAL_DATA_RAM_BYTES_TESTED_PER_ITERATION,
+                                                                                          DATA_RAM_MAX_CRITICAL_SECTION_CYCLES,
+                                                                                          execTestData ); 
+
+            execTestData.m_NmbrTimesToRunPerDiagCycle        = DFLT_NBR_TIMES_TO_RUN_PER_DIAG_CYCLE;
+    
+
+            //***********************************************************************************************************
+            //                                                                                                          *
+            // SDRAM testing parameters, structures and definitions.                                                    *
+            //                                                                                                          *
+            //***********************************************************************************************************
+
+            //
+            // An SDRAM access takes many times as long as an L1 access, so SDRAM has its own test with its own timing.
+            // Fewer patterns are written so a word costs about as much as in L1, the critical section is sized from the
+            // cycles per word measured on SDRAM, and more iterations are batched when the system is idle to get 
+            // through the much larger memory in a diagnostic cycle.  Blocks are saved and restored by memory DMA and
+            // flushed from the data cache, SDRAM is cacheable.  Each iteration tests enough of the SDRAM data for all
+            // of it to be tested in half the period all the diagnostics must complete in, even on a system that is 
+            // never idle so no iterations are batched.
+            //
+            static const UINT32 MIN_SDRAM_BYTES_TESTED_PER_ITERATION  = 0x400;
+            static const UINT32 SDRAM_TEST_ITERATION_PERIOD_MS        = 250;
+            static const UINT32 SDRAM_TEST_ITERATIONS_PER_DEADLINE    = ( PERIOD_FOR_ALL_DIAGNOSTICS_COMPLETED_MS / 2 ) 
+                                                                        / SDRAM_TEST_ITERATION_PERIOD_MS;
+            static const UINT32 SDRAM_TEST_MAX_ITERATIONS_PER_BATCH   = 64;   // Up to 64 iterations at a time when idle
+            static const UINT32 SDRAM_MAX_CRITICAL_SECTION_CYCLES     = US_TO_CCLK( 10 );  // Apex ISR latency bound
+            static const BOOL   SDRAM_TEST_USES_MDMA                  = TRUE;
+
+            UINT32 nmbrSdramBytesTestedPerIteration = ( reinterpret_cast<UINT32>( &ldf_sdram_data_length ) 
+                                                        + SDRAM_TEST_ITERATIONS_PER_DEADLINE - 1 ) 
+                                                      / SDRAM_TEST_ITERATIONS_PER_DEADLINE;
+
+            if ( nmbrSdramBytesTestedPerIteration < MIN_SDRAM_BYTES_TESTED_PER_ITERATION )
+            {
+                nmbrSdramBytesTestedPerIteration = MIN_SDRAM_BYTES_TESTED_PER_ITERATION;
+            }
+
+            // SDRAM is tested a whole word at a time.
+            nmbrSdramBytesTestedPerIteration = ( nmbrSdramBytesTestedPerIteration + sizeof( UINT32 ) - 1 )
+                                               & ~( sizeof( UINT32 ) - 1 );
+
+            // The test patterns and the test object, with the buffer blocks are saved to, are read and written while
+            // a block is saved, so they are placed in L1 data memory.
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+#pragma section("L1_data")
+#endif
+            static UINT32 SDRAM_TEST_PATTERNS[]  = 
+                                                    { 
+                                                        0xffffffff, 0,          0x55555555, 0xaaaaaaaa 
+                                                    };
+
+            execTestData.m_IterationPeriod                   = SDRAM_TEST_ITERATION_PERIOD_MS;
+       		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_SDRAM_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = SDRAM_TEST_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
+
+            // SDRAM regions tested, bounds come from the .ldf file.  Nothing in the SDRAM data section is excluded.
+            static BlackfinDiagnosticTesting::BlackfinDiagSdram::SdramTestDescriptor SDRAM_REGIONS[] =
+                    {
+                        {
+                            &ldf_sdram_data_start,
+                            reinterpret_cast<UINT32>( &ldf_sdram_data_length ),
+                            0,
+                            FALSE,
+                            TRUE
+                        }  // SDRAM data
+                    };
+
+            // Create SDRAM Test object.  Refer to BlackfinDiagSdram.hpp and BlackfinDiagSdram.cpp for a description.
+#if !defined(BLACKFIN_DIAG_HOST_BUILD)
+#pragma section("L1_data")
+#endif
+            static BlackfinDiagnosticTesting::BlackfinDiagSdram m_SdramTest( SDRAM_REGIONS,
+                                                                             ( sizeof( SDRAM_REGIONS ) 
+                                                                                 / sizeof( SDRAM_REGIONS[ 0 ] ) ),
+                                                                             NULL,
+                                                                             0,
+                                                                             SDRAM_TEST_PATTERNS,
+                                                                             ( sizeof( SDRAM_TEST_PATTERNS ) / sizeof( UINT32 ) ),
+                                                                             nmbrSdramBytesTestedPerIteration,
+                                                                             SDRAM_MAX_CRITICAL_SECTION_CYCLES,
+                                                                             SDRAM_TEST_USES_MDMA,
+                                                                             execTestData );
+
+
+            //***********************************************************************************************************
+            //                                                                                                          *
+            // Unused stack testing parameters, structures and definitions.                                             *
+            //                                                                                                          *
+            //***********************************************************************************************************
+
+            //
+            // The part of each task's stack that has never been used still holds the zero fill, so it is tested 
+            // without being saved and restored.  Each iteration tests a block of one stack in one critical section.
+            //
+            static const UINT32 NMBR_UNUSED_STACK_WORDS_TESTED_PER_ITERATION = 0x40;
+            static const UINT32 UNUSED_STACK_TEST_ITERATION_PERIOD_MS        = 100;
+            static const UINT32 UNUSED_STACK_MAX_CRITICAL_SECTION_CYCLES     = US_TO_CCLK( 10 );  // Apex ISR latency bound
+
+            static UINT32 UNUSED_STACK_TEST_PATTERNS[]  = 
+                                                    { 
+                                                        0xffffffff, 0,          0x55555555, 0xaaaaaaaa 
+                                                    };
+
+            execTestData.m_IterationPeriod                   = UNUSED_STACK_TEST_ITERATION_PERIOD_MS;
+       		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_UNUSED_STACK_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = DFLT_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
+
+            // Create unused stack Test object.  Refer to BlackfinDiagUnusedStack.hpp and BlackfinDiagUnusedStack.cpp 
+            // for a description.
+            static BlackfinDiagnosticTesting::BlackfinDiagUnusedStack m_UnusedStackTest( UNUSED_STACK_TEST_PATTERNS,
+                                                                                         ( sizeof( UNUSED_STACK_TEST_PATTERNS ) 
+                                                                                             / sizeof( UINT32 ) ),
+                                                                                         NMBR_UNUSED_STACK_WORDS_TESTED_PER_ITERATION,
+                                                                                         UNUSED_STACK_MAX_CRITICAL_SECTION_CYCLES,
+                                                                                         execTestData );
+
+
+            //***********************************************************************************************************
+            //                                                                                                          *
+            // Read only data testing parameters, structures and definitions.                                           *
+            //                                                                                                          *
+            //***********************************************************************************************************
+            static const UINT32 READ_ONLY_DATA_TEST_ITERATION_PERIOD_MS    = 1000;
+            static const UINT32 NMBR_READ_ONLY_BYTES_CHECKED_PER_ITERATION = 0x400;
     
+            execTestData.m_IterationPeriod                   = READ_ONLY_DATA_TEST_ITERATION_PERIOD_MS;
+       		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_READ_ONLY_DATA_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = DFLT_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
+
+            // Read only regions checked, bounds come from the .ldf file.  The golden CRCs are computed in one pass over
+            // each region when the test is constructed at boot.
+            static BlackfinDiagnosticTesting::BlackfinDiagReadOnlyData::ReadOnlyRegionDescriptor READ_ONLY_REGIONS[] =
+                    {
+                        {
+                            &ldf_l1_constdata_start,
+                            reinterpret_cast<UINT32>( &ldf_l1_constdata_length ),
+                            0,
+                            FALSE,
+                            0,
+                            BlackfinDiagnosticTesting::CRC32_INITIAL_VALUE,
+                            FALSE
+                        }, // Constant data in L1 data memory
+                        {
+                            &ldf_sdram_constdata_start,
+                            reinterpret_cast<UINT32>( &ldf_sdram_constdata_length ),
+                            0,
+                            FALSE,
+                            0,
+                            BlackfinDiagnosticTesting::CRC32_INITIAL_VALUE,
+                            FALSE
+                        }  // Constant data in external memory
+                    };
+
+            // Create Read Only Data Test object.  Refer to BlackfinDiagReadOnlyData.hpp and 
+            // BlackfinDiagReadOnlyData.cpp for a description.
+            static BlackfinDiagnosticTesting::BlackfinDiagReadOnlyData m_ReadOnlyDataTest( READ_ONLY_REGIONS,
+                                                                                           ( sizeof( READ_ONLY_REGIONS ) 
+                                                                                               / sizeof( READ_ONLY_REGIONS[ 0 ] ) ),
+                                                                                           NMBR_READ_ONLY_BYTES_CHECKED_PER_ITERATION,
+                                                                                           execTestData );
+
 
             //***********************************************************************************************************
             //                                                                                                          *
@@ -197,6 +584,8 @@ namespace BlackfinDiagRuntimeEnvironment
 	
             execTestData.m_IterationPeriod                   = REGISTER_TEST_ITERATION_PERIOD_MS;
        		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_REGISTER_TEST_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = DFLT_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = DFLT_NO_PREREQUISITE_TEST_TYPES;
 
 
             // Create Register Test object.  Refer to BlackfinDiagRegistersTest.hpp and BlackfinDiagRegistersTest.cpp 
@@ -209,10 +598,13 @@ namespace BlackfinDiagRuntimeEnvironment
             // Instruction RAM testing parameters, structures and definitions.                                          *
             //                                                                                                          *
             //***********************************************************************************************************
-            static const UINT32 INSTRCTN_RAM_TEST_ITERATION_PERIOD_MS = 15000;          // 15 seconds for now
+            static const UINT32 INSTRCTN_RAM_TEST_ITERATION_PERIOD_MS   = 15000;          // 15 seconds for now
+            static const UINT32 INSTRCTN_RAM_TEST_MAX_ITERATIONS_PER_BATCH = 8;
     
             execTestData.m_IterationPeriod                   = INSTRCTN_RAM_TEST_ITERATION_PERIOD_MS;
             execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_INTRUCTION_RAM_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = INSTRCTN_RAM_TEST_MAX_ITERATIONS_PER_BATCH;
+            execTestData.m_PrerequisiteTestTypes             = MEMORY_TEST_PREREQUISITE_TEST_TYPES;
 
             // Create Instruction Ram Test object.  Refer to BlackfinInstructionRam.hpp and BlackfinInstructionRam.cpp 
             // for a description.
@@ -226,6 +618,8 @@ namespace BlackfinDiagRuntimeEnvironment
             static const UINT32 TIMER_TEST_ITERATION_PERIOD_MS =  10000;  // Start after 10 seconds.
             execTestData.m_IterationPeriod                   = TIMER_TEST_ITERATION_PERIOD_MS;
        		execTestData.m_TestType                          = DiagnosticTesting::DiagnosticTest::DIAG_TIMER_TEST_TYPE;
+            execTestData.m_MaxIterationsPerBatch             = DFLT_MAX_ITERATIONS_PER_BATCH;  // Timing must not be batched
+            execTestData.m_PrerequisiteTestTypes             = DFLT_NO_PREREQUISITE_TEST_TYPES;
 
             // Create Timer Test object.  Refer to BlackfinTimerTest.hpp and BlackfinTimerTest.cpp 
             // for a description.
@@ -261,17 +655,34 @@ namespace BlackfinDiagRuntimeEnvironment
 	
             static const UINT32 ALL_DIAG_DID_NOT_COMPLETE_ERR  = 4;
         	
+            static const UINT32 PERIOD_FOR_ONE_DIAGNOSTIC_TEST_ITERATION_MS = 50; // Milleseconds
+
             //
-            // Requirement:  All Diagnostic Tests Complete in 4 Hours.
+            // Longest a test can be paused per diagnostic cycle.  Erasing and burning the calibration sector takes 
+            // seconds, this leaves room for a number of them.
             //
-            static const UINT32 PERIOD_FOR_ALL_DIAGNOSTICS_COMPLETED_MS     = 2 * 60 * 60 * 1000; // 2 hours for now, number of milleseconds in 4 hours
-    
-            static const UINT32 PERIOD_FOR_ONE_DIAGNOSTIC_TEST_ITERATION_MS = 50; // Milleseconds
+            static const UINT32 MAX_TEST_PAUSE_TIME_MS                      = 10 * 60 * 1000; // 10 minutes
+
+            //
+            // Most time a batch of back to back iterations of one test can take when the system is idle.  Kept well 
+            // inside the scheduling period so foreground work that becomes ready waits at most this long.
+            //
+            static const UINT32 IDLE_BATCH_TICK_BUDGET                      = US_TO_CCLK( 2000 ); // 2 milleseconds
+
+            //
+            // Start the next diagnostic cycle as soon as all tests complete so the time to detect a fault is the time
+            // a pass actually takes rather than PERIOD_FOR_ALL_DIAGNOSTICS_COMPLETED_MS.
+            //
+            static const BOOL   START_NEXT_CYCLE_WHEN_COMPLETE              = TRUE;
 
             static DiagnosticTesting::DiagnosticTest * pDiagnosticTests[]    = 
                                                      {
                                                          &m_RegisterTest,
                                                          &m_DataRamTest, 
+                                                         &m_CriticalDataRamTest, 
+                                                         &m_SdramTest,
+                                                         &m_UnusedStackTest,
+                                                         &m_ReadOnlyDataTest,
 //
 // When debugging other system issues, if this conditional is FALSE then the timer test and the instruction ram test will fail probably
 // 
@@ -304,7 +715,11 @@ namespace BlackfinDiagRuntimeEnvironment
                                                 CORRUPTED_DIAG_TEST_VECTOR_ERR,
                                                 CORRUPTED_DIAG_TEST_MEMORY_ERR,
                                                 TEST_TOOK_TOO_LONG_ERR,
-                                                ALL_DIAG_DID_NOT_COMPLETE_ERR
+                                                ALL_DIAG_DID_NOT_COMPLETE_ERR,
+                                                MAX_TEST_PAUSE_TIME_MS,
+                                                &IsSystemIdle,
+                                                IDLE_BATCH_TICK_BUDGET,
+                                                START_NEXT_CYCLE_WHEN_COMPLETE
     	                                    }; 
 	    
             static DiagnosticScheduling::DiagnosticScheduler<DiagnosticTesting::DiagnosticTest> Schedule
@@ -321,6 +736,93 @@ namespace BlackfinDiagRuntimeEnvironment
     	pSchedule->RunScheduled(); 
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRuntime: PauseMemoryDiagnostics
+    ///
+    /// @par Full Description
+    ///      Pause the instruction RAM, data RAM, SDRAM and unused stack tests while the application is busy
+    ///      with flash.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRuntime::PauseMemoryDiagnostics() 
+    { 
+        if ( NULL == pSchedule ) 
+        {
+            return;
+        }
+        
+        pSchedule->PauseTest( DiagnosticTesting::DiagnosticTest::DIAG_INTRUCTION_RAM_TEST_TYPE );
+        
+        pSchedule->PauseTest( DiagnosticTesting::DiagnosticTest::DIAG_DATA_RAM_TEST_TYPE );
+        
+        pSchedule->PauseTest( DiagnosticTesting::DiagnosticTest::DIAG_CRITICAL_DATA_RAM_TEST_TYPE );
+        
+        pSchedule->PauseTest( DiagnosticTesting::DiagnosticTest::DIAG_SDRAM_TEST_TYPE );
+        
+        pSchedule->PauseTest( DiagnosticTesting::DiagnosticTest::DIAG_UNUSED_STACK_TEST_TYPE );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRuntime: ResumeMemoryDiagnostics
+    ///
+    /// @par Full Description
+    ///      Resume the instruction RAM, data RAM, SDRAM and unused stack tests paused by PauseMemoryDiagnostics.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRuntime::ResumeMemoryDiagnostics() 
+    { 
+        if ( NULL == pSchedule ) 
+        {
+            return;
+        }
+        
+        pSchedule->ResumeTest( DiagnosticTesting::DiagnosticTest::DIAG_INTRUCTION_RAM_TEST_TYPE );
+        
+        pSchedule->ResumeTest( DiagnosticTesting::DiagnosticTest::DIAG_DATA_RAM_TEST_TYPE );
+        
+        pSchedule->ResumeTest( DiagnosticTesting::DiagnosticTest::DIAG_CRITICAL_DATA_RAM_TEST_TYPE );
+        
+        pSchedule->ResumeTest( DiagnosticTesting::DiagnosticTest::DIAG_SDRAM_TEST_TYPE );
+        
+        pSchedule->ResumeTest( DiagnosticTesting::DiagnosticTest::DIAG_UNUSED_STACK_TEST_TYPE );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRuntime: GetSchedulerStatistics
+    ///
+    /// @par Full Description
+    ///      Get the measurements of the time the scheduler has spent in RunScheduled.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagRuntime::GetSchedulerStatistics( BlackfinDiagSchedule::SchedulerStatistics & rStatistics ) 
+    { 
+        if ( NULL == pSchedule ) 
+        {
+            return FALSE;
+        }
+        
+        pSchedule->GetSchedulerStatistics( rStatistics );
+        
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagRuntime: ResetSchedulerStatistics
+    ///
+    /// @par Full Description
+    ///      Clear the measurements of the time the scheduler has spent in RunScheduled.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagRuntime::ResetSchedulerStatistics() 
+    { 
+        if ( NULL == pSchedule ) 
+        {
+            return;
+        }
+        
+        pSchedule->ResetSchedulerStatistics();
+    }
+
 };
 
 
@@ -25,17 +25,22 @@
 // C PROJECT INCLUDES
 // (none)
  
+#if !defined(BLACKFIN_DIAG_RUNTIME_HPP)
+#define BLACKFIN_DIAG_RUNTIME_HPP
+
 // C++ PROJECT INCLUDES
-// (none)
+#include "DiagnosticScheduler.hpp"
+#include "DiagnosticTesting.hpp"
 
 // FORWARD REFERENCES
 // (none)
-#if !defined(BLACKFIN_DIAG_RUNTIME_HPP)
-#define BLACKFIN_DIAG_RUNTIME_HPP
             
 
 namespace BlackfinDiagRuntimeEnvironment 
 {  
+    // The scheduler of the Blackfin diagnostics.
+    typedef DiagnosticScheduling::DiagnosticScheduler<DiagnosticTesting::DiagnosticTest> BlackfinDiagSchedule;
+
     class BlackfinDiagRuntime 
     {
         public:
@@ -60,6 +65,58 @@ namespace BlackfinDiagRuntimeEnvironment
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             static void ExecuteDiagnostics();
             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRuntime: PauseMemoryDiagnostics
+            ///
+            /// @par Full Description
+            ///      Pause the instruction RAM, data RAM, SDRAM and unused stack tests.  Called by the application
+            ///      before heavy foreground work like flash programming so the costly memory tests do not compete for
+            ///      core and bus time.
+            ///      The time paused does not count against the diagnostic cycle, up to a bounded maximum.
+            ///
+            /// @return                             Memory tests paused.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void PauseMemoryDiagnostics();
+            
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRuntime: ResumeMemoryDiagnostics
+            ///
+            /// @par Full Description
+            ///      Resume the instruction RAM, data RAM, SDRAM and unused stack tests paused by
+            ///      PauseMemoryDiagnostics.
+            ///
+            /// @return                             Memory tests resumed.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void ResumeMemoryDiagnostics();
+            
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRuntime: GetSchedulerStatistics
+            ///
+            /// @par Full Description
+            ///      Get the measurements of the time the scheduler has spent in RunScheduled since they were last 
+            ///      reset.  The time spent in scheduler bookkeeping is m_TicksInRunScheduled less m_TicksRunningTests.
+            ///
+            /// @param rStatistics                  Reference to where the statistics are copied to.
+            ///
+            /// @return                             FALSE before the first call to ExecuteDiagnostics creates the
+            ///                                     scheduler.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static BOOL GetSchedulerStatistics( BlackfinDiagSchedule::SchedulerStatistics & rStatistics );
+            
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagRuntime: ResetSchedulerStatistics
+            ///
+            /// @par Full Description
+            ///      Clear the measurements of the time the scheduler has spent in RunScheduled.
+            ///
+            /// @return                             Scheduler statistics cleared.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            static void ResetSchedulerStatistics();
+            
             
         private:
     
@@ -77,6 +134,14 @@ namespace BlackfinDiagRuntimeEnvironment
     
     // Linkage between C and C++
     extern "C" void RunDiagnostics();
+    
+    extern "C" void PauseMemoryDiagnostics();
+    
+    extern "C" void ResumeMemoryDiagnostics();
+    
+    extern "C" BOOL GetSchedulerStatistics( BlackfinDiagSchedule::SchedulerStatistics * pStatistics );
+    
+    extern "C" void ResetSchedulerStatistics();
 
 }; 
     
@@ -0,0 +1,539 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagSdram.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagSdram class.
+///
+/// @see BlackfinDiagSdram.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Os_iotk.h"             // This file depends on Defs.h.  It should include that file
+#include "Hw.h"                  // Ditto
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagSdram.hpp"
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+#include "BlackfinDiagRamSimulator.hpp"
+#endif
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+
+	// Linkage to the assembly language subrouting for flushing and invalidating a range from the data cache.
+	extern "C" void FlushAndInvalidateDataCacheLines( UINT8 * pFirstByte, UINT32 nmbrBytes );
+
+	//
+	// Words of the SDRAM being tested are read and written through these.  On the host they go through the RAM
+	// simulator so faults injected in the simulated memory are seen by the test.
+	//
+	static inline UINT32 ReadSdramWord( const volatile UINT32 * pWord )
+	{
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	    return BlackfinDiagRamSimulator::ReadWord( pWord );
+#else
+	    return *pWord;
+#endif
+	}
+
+	static inline void WriteSdramWord( volatile UINT32 * pWord, UINT32 value )
+	{
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+	    BlackfinDiagRamSimulator::WriteWord( pWord, value );
+#else
+	    *pWord = value;
+#endif
+	}
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: RunTest
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+    ///      this method to run iterations of the diagnostic test.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    DiagnosticTesting::DiagnosticTest::TestState BlackfinDiagSdram::RunTest( UINT32 & rErrorCode )
+    {
+	    ConfigForAnyNewDiagCycle( this );
+
+		DiagnosticTesting::DiagnosticTest::TestState ts = DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+
+	    for ( UINT32 ui = 0; ui < m_NmbrSdramRegions; ++ui )
+	    {
+	        SdramTestDescriptor * pRegion = &m_pSdramRegions[ ui ];
+
+	        if ( pRegion->m_TestCompleted )
+	        {
+	            continue;
+	        }
+
+	        UINT32 * pFailedWord    = NULL;
+
+	        UINT64   iterationStart = 0;
+
+	        UINT64   iterationEnd   = 0;
+
+	        _GET_CYCLE_COUNT( iterationStart );
+
+		    BOOL     hadSuccess     = RunSdramTest( pRegion, pFailedWord );
+
+	        _GET_CYCLE_COUNT( iterationEnd );
+
+	        UINT32   cycles         = static_cast<UINT32>( iterationEnd - iterationStart );
+
+	        if ( cycles > m_TimingStatistics.m_WorstIterationCycles )
+	        {
+	            m_TimingStatistics.m_WorstIterationCycles = cycles;
+	        }
+
+		    if ( !hadSuccess )
+		    {
+		        UINT32 wordOffset = reinterpret_cast<UINT8 *>( pFailedWord ) - pRegion->m_pSdramStart;
+
+		 	    EncodeErrorInfo( rErrorCode, ui + 1, wordOffset / sizeof( UINT32 ) );
+
+		 	    OS_Assert( rErrorCode );
+		    }
+
+		    ts = DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
+
+		    break;
+	    }
+
+	   return ts;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: RunSdramTest
+    ///
+    ///      Tests an "iteration" amount of a region
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagSdram::RunSdramTest( SdramTestDescriptor * pRegion, UINT32 * & rpFailedWord )
+    {
+	    UINT32  nmbrBytesToTestThisIteration = pRegion->m_NmbrBytesToTest - pRegion->m_NmbrBytesTested;
+
+	    if ( nmbrBytesToTestThisIteration > m_NmbrBytesToTestPerIteration )
+	    {
+		    nmbrBytesToTestThisIteration = m_NmbrBytesToTestPerIteration;
+	    }
+
+	    UINT8 * pTestStartAddr = pRegion->m_pSdramStart + pRegion->m_NmbrBytesTested;
+
+	    UINT8 * pChunkEnd      = pTestStartAddr + nmbrBytesToTestThisIteration;
+
+	    BOOL    hadSuccess     = TRUE;
+
+		//
+		// Excluded bytes in the chunk are skipped, the words on either side of them are tested separately.  SDRAM is
+		// only tested a whole word at a time, bytes before the first word boundary and after the last one are not.
+		//
+		while ( hadSuccess && ( pTestStartAddr < pChunkEnd ) )
+		{
+		    UINT8 *  pTestEndAddr = pChunkEnd;
+
+		    pTestStartAddr        = ClipToExclusionRanges( pTestStartAddr, pTestEndAddr );
+
+		    UINT32 * pFirstWord   = reinterpret_cast<UINT32 *>( ( reinterpret_cast<UINT32>(pTestStartAddr) + SDRAM_WORD_ALIGNMENT_MASK )
+		                                                        & ~SDRAM_WORD_ALIGNMENT_MASK );
+
+		    UINT32 * pEndOfWords  = reinterpret_cast<UINT32 *>( reinterpret_cast<UINT32>(pTestEndAddr) & ~SDRAM_WORD_ALIGNMENT_MASK );
+
+		    if ( pFirstWord < pEndOfWords )
+		    {
+		        hadSuccess = TestWords( pRegion->m_FlushCacheLines, pFirstWord, pEndOfWords - pFirstWord, rpFailedWord );
+		    }
+
+		    pTestStartAddr        = pTestEndAddr;
+		}
+
+	    if ( hadSuccess )
+	    {
+		    pRegion->m_NmbrBytesTested += nmbrBytesToTestThisIteration;
+
+		    if ( pRegion->m_NmbrBytesTested >= pRegion->m_NmbrBytesToTest )
+		    {
+			    pRegion->m_TestCompleted = TRUE;
+		    }
+	    }
+
+	    return hadSuccess;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: ClipToExclusionRanges
+    ///
+    ///      Moves the start of a range to test past the exclusion ranges and ends it at the next one
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT8 * BlackfinDiagSdram::ClipToExclusionRanges( UINT8 * pTestStartAddr, UINT8 * & rpTestEndAddr )
+    {
+        //
+        // Ranges may be adjacent or listed in any order, so start over each time the start moves.
+        //
+        UINT32 ui = 0;
+
+        while ( ( ui < m_NmbrExclusionRanges ) && ( pTestStartAddr < rpTestEndAddr ) )
+        {
+            UINT8 * pExcludedStart = m_pExclusionRanges[ ui ].m_pExcludedStart;
+
+            UINT8 * pExcludedEnd   = pExcludedStart + m_pExclusionRanges[ ui ].m_NmbrExcludedBytes;
+
+            if ( ( pTestStartAddr >= pExcludedStart ) && ( pTestStartAddr < pExcludedEnd ) )
+            {
+                pTestStartAddr = pExcludedEnd;
+
+                ui             = 0;
+            }
+            else
+            {
+                ++ui;
+            }
+        }
+
+        if ( pTestStartAddr >= rpTestEndAddr )
+        {
+            return rpTestEndAddr;
+        }
+
+        for ( ui = 0; ui < m_NmbrExclusionRanges; ++ui )
+        {
+            UINT8 * pExcludedStart = m_pExclusionRanges[ ui ].m_pExcludedStart;
+
+            if ( ( pExcludedStart > pTestStartAddr ) && ( pExcludedStart < rpTestEndAddr ) )
+            {
+                rpTestEndAddr = pExcludedStart;
+            }
+        }
+
+        return pTestStartAddr;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: TestWords
+    ///
+    ///      Tests a range of words of SDRAM a block at a time
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagSdram::TestWords( BOOL flushCacheLines, UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord )
+    {
+        BOOL testPassed = TRUE;
+
+        while ( testPassed && ( nmbrWords > 0 ) )
+        {
+            UINT32 nmbrWordsInBlock = ( nmbrWords > m_TimingStatistics.m_WordsPerCriticalSection )
+                                      ? m_TimingStatistics.m_WordsPerCriticalSection : nmbrWords;
+
+            if ( IsTestDataInBlock( pFirstWord, nmbrWordsInBlock ) )
+            {
+                ++m_TimingStatistics.m_NmbrBlocksSkipped;
+            }
+            else
+            {
+                testPassed = TestBlock( flushCacheLines, pFirstWord, nmbrWordsInBlock, rpFailedWord );
+            }
+
+            pFirstWord += nmbrWordsInBlock;
+
+            nmbrWords  -= nmbrWordsInBlock;
+        }
+
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: TestBlock
+    ///
+    ///      Saves a block, tests it with each pattern and restores it with interrupts disabled
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagSdram::TestBlock( BOOL flushCacheLines, UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord )
+    {
+        volatile UINT32 * pBlock     = pFirstWord;
+
+        UINT32            nmbrBytes  = nmbrWords * sizeof( UINT32 );
+
+        BOOL              testPassed = TRUE;
+
+        DisableInterrupts();
+
+        //
+        // Dirty lines are written back before the save so a memory DMA save reads the live data.  Lines are
+        // invalidated before each read back so it reads the SDRAM, and before the restore so no line holding a test
+        // pattern is left behind a memory DMA restore.
+        //
+        if ( flushCacheLines )
+        {
+            FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pFirstWord ), nmbrBytes );
+        }
+
+        CopyWords( pFirstWord, m_SaveBuffer, nmbrWords );
+
+        for ( UINT32 pattern = 0; testPassed && ( pattern < m_NmbrTestPatterns ); ++pattern )
+        {
+            UINT32 testPattern = m_pTestPatterns[ pattern ];
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                WriteSdramWord( pBlock + ui, testPattern );
+            }
+
+            if ( flushCacheLines )
+            {
+                FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pFirstWord ), nmbrBytes );
+            }
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                if ( ReadSdramWord( pBlock + ui ) != testPattern )
+                {
+                    rpFailedWord = pFirstWord + ui;
+
+                    testPassed   = FALSE;
+
+                    break;
+                }
+            }
+        }
+
+        if ( flushCacheLines )
+        {
+            FlushAndInvalidateDataCacheLines( reinterpret_cast<UINT8 *>( pFirstWord ), nmbrBytes );
+        }
+
+        CopyWords( m_SaveBuffer, pFirstWord, nmbrWords );
+
+        UINT32 cycles = EnableInterrupts();
+
+        ++m_TimingStatistics.m_NmbrBlocksTested;
+
+        UpdateTiming( cycles, nmbrWords );
+
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: CopyWords
+    ///
+    ///      Copies a block of words for saving or restoring it, by memory DMA when it is used and available
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::CopyWords( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords )
+    {
+        if ( m_UseMdma && m_Mdma.StartCopy( pSource, pDestination, nmbrWords ) && m_Mdma.WaitForCopy() )
+        {
+            return;
+        }
+
+        const volatile UINT32 * pFrom = pSource;
+
+        volatile UINT32 *       pTo   = pDestination;
+
+        for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+        {
+            WriteSdramWord( pTo + ui, ReadSdramWord( pFrom + ui ) );
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: IsTestDataInBlock
+    ///
+    ///      Determines if a block of words holds data the test uses while the block is saved
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagSdram::IsTestDataInBlock( UINT32 * pFirstWord, UINT32 nmbrWords )
+    {
+        UINT32 blockStart     = reinterpret_cast<UINT32>( pFirstWord );
+
+        UINT32 blockEnd       = blockStart + ( nmbrWords * sizeof( UINT32 ) );
+
+        // The stack the test runs on is around this local variable.
+        UINT32 stackLocation  = reinterpret_cast<UINT32>( &blockStart );
+
+        UINT32 inUseStart[]   =
+                                {
+                                    reinterpret_cast<UINT32>( this ),
+                                    reinterpret_cast<UINT32>( m_pTestPatterns ),
+                                    stackLocation - SDRAM_STACK_GUARD_BYTES
+                                };
+
+        UINT32 inUseEnd[]     =
+                                {
+                                    reinterpret_cast<UINT32>( this + 1 ),
+                                    reinterpret_cast<UINT32>( m_pTestPatterns + m_NmbrTestPatterns ),
+                                    stackLocation + SDRAM_STACK_GUARD_BYTES
+                                };
+
+        for ( UINT32 ui = 0; ui < ( sizeof( inUseStart ) / sizeof( UINT32 ) ); ++ui )
+        {
+            if ( ( blockStart < inUseEnd[ ui ] ) && ( inUseStart[ ui ] < blockEnd ) )
+            {
+                return TRUE;
+            }
+        }
+
+        return FALSE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: UpdateTiming
+    ///
+    ///      Keeps the most cycles measured for one word and per word past the first and sizes the next critical
+    ///      section from them
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::UpdateTiming( UINT32 cycles, UINT32 nmbrWords )
+    {
+        SdramTimingStatistics & rTiming = m_TimingStatistics;
+
+        if ( 1 == nmbrWords )
+        {
+            if ( cycles > rTiming.m_OneWordCycles )
+            {
+                rTiming.m_OneWordCycles = cycles;
+            }
+        }
+        else
+        {
+            UINT32 cyclesPerWord = 0;
+
+            if ( 0 == rTiming.m_OneWordCycles )
+            {
+                // Only when critical sections are not limited, the fixed cost is charged to the words.
+                cyclesPerWord = ( cycles + nmbrWords - 1 ) / nmbrWords;
+            }
+            else if ( cycles > rTiming.m_OneWordCycles )
+            {
+                cyclesPerWord = ( cycles - rTiming.m_OneWordCycles + nmbrWords - 2 ) / ( nmbrWords - 1 );
+            }
+
+            if ( cyclesPerWord > rTiming.m_CyclesPerWord )
+            {
+                rTiming.m_CyclesPerWord = cyclesPerWord;
+            }
+        }
+
+        UINT32 nmbrWordsThatFit = SDRAM_SAVE_BUFFER_WORDS;
+
+        if ( m_MaxCriticalSectionCycles > 0 )
+        {
+            if ( ( 0 == rTiming.m_OneWordCycles ) || ( rTiming.m_OneWordCycles >= m_MaxCriticalSectionCycles ) )
+            {
+                nmbrWordsThatFit = 1;
+            }
+            else if ( 0 == rTiming.m_CyclesPerWord )
+            {
+                // No word costs more than a critical section of one word, the fixed cost included.
+                nmbrWordsThatFit = m_MaxCriticalSectionCycles / rTiming.m_OneWordCycles;
+            }
+            else
+            {
+                nmbrWordsThatFit = 1 + ( ( m_MaxCriticalSectionCycles - rTiming.m_OneWordCycles ) / rTiming.m_CyclesPerWord );
+            }
+        }
+
+        rTiming.m_WordsPerCriticalSection = ( nmbrWordsThatFit < SDRAM_SAVE_BUFFER_WORDS )
+                                            ? nmbrWordsThatFit : SDRAM_SAVE_BUFFER_WORDS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: EncodeErrorInfo
+    ///
+    ///      Encoding information about a test failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 regionNumber, UINT32 wordOffset )
+    {
+        rErrorInfo  = GetTestType() << DIAG_ERROR_TYPE_BIT_POS;
+
+        rErrorInfo |= regionNumber << SDRAM_REGION_FAILURE_BIT_POS;
+
+        rErrorInfo |= wordOffset & SDRAM_WORD_OFFSET_ERROR_MASK;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: ConfigureForNextTestCycle
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class. This method is called
+    ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+    ///      initialized for an individual test is initialized.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::ConfigureForNextTestCycle()
+    {
+	    for ( UINT32 ui = 0; ui < m_NmbrSdramRegions; ++ui )
+	    {
+	        m_pSdramRegions[ ui ].m_TestCompleted   = FALSE;
+
+	        m_pSdramRegions[ ui ].m_NmbrBytesTested = 0;
+	    }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: GetTimingStatistics
+    ///
+    ///      Get the timing measured testing SDRAM
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::GetTimingStatistics( SdramTimingStatistics & rStatistics )
+    {
+        rStatistics = m_TimingStatistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagSdram: GetMdmaStatistics
+    ///
+    ///      Get the counts kept of the blocks saved and restored by memory DMA
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagSdram::GetMdmaStatistics( BlackfinDiagMdma::MdmaStatistics & rStatistics )
+    {
+        m_Mdma.GetStatistics( rStatistics );
+    }
+
+	UINT32 BlackfinDiagSdram::EnableInterrupts()
+	{
+	    UINT64 timestamp = 0;
+
+	    _GET_CYCLE_COUNT( timestamp );
+
+		sti(m_Critical);
+
+		UINT32 cycles = static_cast<UINT32>( timestamp - m_CriticalSectionStart );
+
+		if ( cycles > m_TimingStatistics.m_WorstCriticalSectionCycles )
+		{
+			m_TimingStatistics.m_WorstCriticalSectionCycles = cycles;
+		}
+
+		return cycles;
+	}
+
+	void BlackfinDiagSdram::DisableInterrupts()
+	{
+		m_Critical = cli();
+
+		_GET_CYCLE_COUNT( m_CriticalSectionStart );
+	}
+
+}
+
@@ -0,0 +1,401 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagSdram.hpp
+///
+/// Namespace for the external SDRAM diagnostic test
+///
+/// @par Full Description
+///
+/// Diagnostic testing for the external SDRAM regions registered with the test.  SDRAM holds live data so it is tested
+/// a block at a time, with interrupts disabled the block is saved to a buffer in L1 memory, each test pattern is
+/// written over the whole block and read back, and the block is restored.  The block may be saved and restored by
+/// memory DMA instead of by the core.  Regions the data cache can hold may have each block flushed and invalidated
+/// from the cache around the save, the read back of each pattern and the restore, so the SDRAM is tested rather than
+/// lines in the cache.  An SDRAM access takes many core cycles, so the number of words per critical section is sized
+/// from the cycles per word measured on SDRAM alone, independent of the L1 data RAM test, and the timing measured is
+/// kept so it can be reported.  Ranges holding live data that must never be overwritten, like buffers peripherals
+/// write by DMA, are excluded from testing.  Blocks holding data the test uses while the block is saved, its own
+/// object, the test patterns or the stack, are skipped and counted.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_SDRAM_HPP)
+#define BLACKFIN_DIAG_SDRAM_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include <ccblkfn.h>                              /* cli/sti( ) */
+
+// C++ PROJECT INCLUDES
+#include "DiagnosticTesting.hpp"
+#include "BlackfinDiagMdma.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 SDRAM_REGION_FAILURE_BIT_POS  = 24;      // Region number, 1 for the first region
+    static const UINT32 SDRAM_WORD_OFFSET_ERROR_MASK  = 0xffffff; // Offset in words from the region start
+    static const UINT32 SDRAM_SAVE_BUFFER_WORDS       = 0x80;    // Most words saved, tested and restored at a time
+    static const UINT32 SDRAM_STACK_GUARD_BYTES       = 0x200;   // Stack around the test that is not overwritten
+    static const UINT32 SDRAM_WORD_ALIGNMENT_MASK     = 0x3;
+
+    class BlackfinDiagSdram : public DiagnosticTesting::DiagnosticTest
+    {
+        public:
+
+            // For external SDRAM memory regions
+            typedef struct
+            {
+    	        UINT8 *          m_pSdramStart;
+    	        UINT32           m_NmbrBytesToTest;
+    	        UINT32           m_NmbrBytesTested;
+    	        BOOL             m_TestCompleted;
+    	        BOOL             m_FlushCacheLines;     // For regions the data cache can hold
+            }
+            SdramTestDescriptor;
+
+            // A range of SDRAM that is never tested, it holds live data that can change with interrupts disabled.
+            typedef struct
+            {
+    	        UINT8 *          m_pExcludedStart;
+    	        UINT32           m_NmbrExcludedBytes;
+            }
+            SdramExclusionRange;
+
+            // Timing measured testing SDRAM, for tuning the bytes per iteration and the critical section length.
+            typedef struct
+            {
+                UINT32           m_OneWordCycles;               // Most measured for a critical section of one word
+                UINT32           m_CyclesPerWord;               // Most measured per word past the first
+                UINT32           m_WordsPerCriticalSection;     // Words the next critical section will test
+                UINT32           m_WorstCriticalSectionCycles;
+                UINT32           m_WorstIterationCycles;        // Longest iteration, with interrupts enabled between
+                UINT32           m_NmbrBlocksTested;
+                UINT32           m_NmbrBlocksSkipped;           // Held data the test uses
+            }
+            SdramTimingStatistics;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: BlackfinDiagSdram
+            ///
+            /// @par Full Description
+            ///      Construction that is used to construct the BlackfinDiagSdram object that is used to test external
+            ///      SDRAM.  It is derived from the DiagnosticTesting::DiagnosticTest base class.  The object, the test
+            ///      patterns and the stack the test runs on are expected to be in L1 memory.
+            ///
+            ///
+            /// @param pSdramRegions                Array of the SDRAM memory regions to test, tested in order.
+            ///        nmbrSdramRegions             Number of regions in the array, at most 3.
+            ///        pExclusionRanges             Array of ranges within the regions that are not tested, NULL for
+            ///                                     none.
+            ///        nmbrExclusionRanges          Number of ranges in the array.
+            ///        pTestPatterns                The array of 32 bit test patterns written over each block.
+            ///        nmbrTestPatterns             Size of the the array of test patterns.
+            ///        nmbrBytesToTestPerIteration  Number of bytes of SDRAM per iteration of the test.
+            ///        maxCriticalSectionCycles     Most cycles interrupts are to be disabled for at a time, 0 for no
+            ///                                     limit.  A single word is always tested at once.
+            ///        useMdma                      TRUE to save and restore the blocks with memory DMA.
+            ///        ExecuteTestData              Initial runtime data passed to the base for running this test.
+            ///
+            /// @return                             Blackfin SDRAM diagnostic instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagSdram( SdramTestDescriptor *       pSdramRegions,
+	                           UINT32                      nmbrSdramRegions,
+	                           const SdramExclusionRange * pExclusionRanges,
+	                           UINT32                      nmbrExclusionRanges,
+	                           const UINT32 *              pTestPatterns,
+	                           UINT32                      nmbrTestPatterns,
+	                           UINT32                      nmbrBytesToTestPerIteration,
+	                           UINT32                      maxCriticalSectionCycles,
+	                           BOOL                        useMdma,
+		    		           DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData )
+						    :  DiagnosticTesting::DiagnosticTest ( rTestData ),
+	                       	   m_pSdramRegions                   ( pSdramRegions ),
+	                       	   m_NmbrSdramRegions                ( nmbrSdramRegions ),
+	                       	   m_pExclusionRanges                ( pExclusionRanges ),
+	                       	   m_NmbrExclusionRanges             ( nmbrExclusionRanges ),
+							   m_pTestPatterns                   ( pTestPatterns ),
+							   m_NmbrTestPatterns                ( nmbrTestPatterns ),
+	                       	   m_NmbrBytesToTestPerIteration     ( nmbrBytesToTestPerIteration ),
+							   m_MaxCriticalSectionCycles        ( maxCriticalSectionCycles ),
+							   m_UseMdma                         ( useMdma ),
+							   m_CriticalSectionStart            ( 0 )
+	        {
+	            m_TimingStatistics.m_OneWordCycles              = 0;
+	            m_TimingStatistics.m_CyclesPerWord              = 0;
+	            m_TimingStatistics.m_WordsPerCriticalSection    = ( 0 == maxCriticalSectionCycles ) ? SDRAM_SAVE_BUFFER_WORDS : 1;
+	            m_TimingStatistics.m_WorstCriticalSectionCycles = 0;
+	            m_TimingStatistics.m_WorstIterationCycles       = 0;
+	            m_TimingStatistics.m_NmbrBlocksTested           = 0;
+	            m_TimingStatistics.m_NmbrBlocksSkipped          = 0;
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: RunTest
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+            ///      this method to run iterations of the diagnostic test.
+            ///
+            ///
+            /// @param                            Reference to a possible error code returned from the scheduler.
+            ///
+            /// @return                           Status of executing a test
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        DiagnosticTest::TestState RunTest( UINT32 & rErrorCode  );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: GetTimingStatistics
+            ///
+            /// @par Full Description
+            ///      Get the timing measured testing SDRAM since the test was constructed.
+            ///
+            ///
+            /// @param      rStatistics           Filled in with the timing.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetTimingStatistics( SdramTimingStatistics & rStatistics );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: GetMdmaStatistics
+            ///
+            /// @par Full Description
+            ///      Get the counts kept of the blocks saved and restored by memory DMA.
+            ///
+            ///
+            /// @param      rStatistics           Filled in with the counts.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetMdmaStatistics( BlackfinDiagMdma::MdmaStatistics & rStatistics );
+
+        protected:
+
+	        //***************************************************************************
+            // PROTECTED METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: ConfigureForNextTestCycle
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class. This method is called
+            ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+            ///      initialized for an individual test is initialized.
+            ///
+            /// @param                            None.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ConfigureForNextTestCycle();
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagSdram(const BlackfinDiagSdram &);
+
+	        const BlackfinDiagSdram & operator = (const BlackfinDiagSdram & );
+
+            BlackfinDiagSdram();
+
+            // For saving status of processor when interrupts are disabled and restoring the state when re-enabling.
+            INT                        m_Critical;
+
+            // Descriptors for testing individual memory regions.
+            SdramTestDescriptor *      m_pSdramRegions;
+
+            UINT32                     m_NmbrSdramRegions;
+
+            // Ranges within the memory regions that are not tested.
+            const SdramExclusionRange * m_pExclusionRanges;
+
+            UINT32                     m_NmbrExclusionRanges;
+
+	        // The test pattern array
+	        const UINT32 *             m_pTestPatterns;
+
+	        // Number of test patterns in the test pattern array.
+	        UINT32                     m_NmbrTestPatterns;
+
+	        // Number of bytes to test per iteration of the test.
+	        UINT32                     m_NmbrBytesToTestPerIteration;
+
+	        // Most cycles interrupts are to be disabled for at a time, 0 for no limit.
+	        UINT32                     m_MaxCriticalSectionCycles;
+
+	        // TRUE to save and restore blocks with memory DMA.
+	        BOOL                       m_UseMdma;
+
+	        // Cycle count when interrupts were last disabled.
+	        UINT64                     m_CriticalSectionStart;
+
+	        // Timing measured so far.
+	        SdramTimingStatistics      m_TimingStatistics;
+
+	        // Contents of the block being tested are saved here and restored afterwards.
+	        UINT32                     m_SaveBuffer[ SDRAM_SAVE_BUFFER_WORDS ];
+
+	        // Saves and restores blocks by memory DMA.
+	        BlackfinDiagMdma           m_Mdma;
+
+            inline void DisableInterrupts();
+
+	        inline UINT32 EnableInterrupts();
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: RunSdramTest
+            ///
+            /// @par Full Description
+            ///      Tests an "iteration" amount of a region, the words between the exclusion ranges.
+            ///
+            /// @param        pRegion              Test information about the region being tested.
+            ///               rpFailedWord         Upon failure the word where the test failed
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL RunSdramTest( SdramTestDescriptor * pRegion, UINT32 * & rpFailedWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: ClipToExclusionRanges
+            ///
+            /// @par Full Description
+            ///      Moves the start of a range of bytes to test past any exclusion range it is in and ends the range
+            ///      at the next exclusion range.
+            ///
+            /// @param        pTestStartAddr  First byte of the range to test.
+            ///               rpTestEndAddr   Byte after the last byte of the range to test, moved back to the start
+            ///                               of the next exclusion range in the range.
+            ///
+            /// @return       First byte to test, equal to rpTestEndAddr when the whole range is excluded.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT8 * ClipToExclusionRanges( UINT8 * pTestStartAddr, UINT8 * & rpTestEndAddr );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: TestWords
+            ///
+            /// @par Full Description
+            ///      Tests a range of words of SDRAM a block at a time, each block as many words as fit in one critical
+            ///      section.
+            ///
+            /// @param        flushCacheLines TRUE to flush and invalidate each block from the data cache before the
+            ///                               save, before each read back and before the restore.
+            ///               pFirstWord      First word to test.
+            ///               nmbrWords       Number of words to test.
+            ///               rpFailedWord    Upon failure the word where the test failed
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestWords( BOOL flushCacheLines, UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: TestBlock
+            ///
+            /// @par Full Description
+            ///      With interrupts disabled saves a block, writes each test pattern over the whole block and reads it
+            ///      back, and restores the block.
+            ///
+            /// @param        flushCacheLines TRUE to flush and invalidate the block from the data cache.
+            ///               pFirstWord      First word of the block.
+            ///               nmbrWords       Number of words in the block, at most SDRAM_SAVE_BUFFER_WORDS.
+            ///               rpFailedWord    Upon failure the word where the test failed
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestBlock( BOOL flushCacheLines, UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: CopyWords
+            ///
+            /// @par Full Description
+            ///      Copies a block of words for saving or restoring it.  Memory DMA does the copy when it is to be
+            ///      used, the core copies the block when DMA is busy or does not complete.
+            ///
+            /// @param        pSource         First word to copy from.
+            ///               pDestination    First word to copy to.
+            ///               nmbrWords       Number of words to copy.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void CopyWords( const UINT32 * pSource, UINT32 * pDestination, UINT32 nmbrWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: IsTestDataInBlock
+            ///
+            /// @par Full Description
+            ///      Determines if a block of words holds data the test uses while the block is saved, its own object,
+            ///      the test patterns or the stack it runs on.
+            ///
+            /// @param        pFirstWord    First word of the block.
+            ///               nmbrWords     Number of words in the block.
+            ///
+            /// @return       TRUE when the block can not be tested
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsTestDataInBlock( UINT32 * pFirstWord, UINT32 nmbrWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: UpdateTiming
+            ///
+            /// @par Full Description
+            ///      Keeps the most cycles measured for a critical section of one word and per word past the first, and
+            ///      sizes the next critical section from them.  The one word critical section carries the fixed cost of
+            ///      the cache flushes and the memory DMA set ups, which is not charged to the words of larger ones.
+            ///
+            /// @param        cycles          Length of the critical section just measured.
+            ///               nmbrWords       Words tested in the critical section.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void UpdateTiming( UINT32 cycles, UINT32 nmbrWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagSdram: EncodeErrorInfo
+            ///
+            /// @par Full Description
+            ///      Encoding information about a test failure
+            ///
+            /// @param        rErrorInfo          A reference for passing back error info to the caller.
+            ///               regionNumber        The region where the failure occurred, 1 for the first region.
+            ///               wordOffset          Offset in words from the start of the region of the failed word.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 regionNumber, UINT32 wordOffset );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_SDRAM_HPP)
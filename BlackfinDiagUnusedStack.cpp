@@ -0,0 +1,463 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagUnusedStack.cpp
+///
+/// Namespace that contains the class definitions, attributes and methods for the BlackfinDiagUnusedStack class.
+///
+/// @see BlackfinDiagUnusedStack.hpp for a detailed description of this class.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Os_iotk.h"             // This file depends on Defs.h.  It should include that file
+#include "Hw.h"                  // Ditto
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagUnusedStack.hpp"
+
+
+// FORWARD REFERENCES
+
+namespace BlackfinDiagnosticTesting
+{
+
+	// Where each task's stack is and how big it is, defined in Os_iotk.c.
+	extern "C" struct STACK_STRUCT stack;
+
+	// Process node of each task created, NULL for the process IDs not in use, defined in Os_iotk.c.
+	extern "C" struct OS_PROC_STRUCT * proc_id_index[ MAX_PROCS ];
+
+    //***************************************************************************
+    // PUBLIC METHODS
+    //***************************************************************************
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: RunTest
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+    ///      this method to run iterations of the diagnostic test.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    DiagnosticTesting::DiagnosticTest::TestState BlackfinDiagUnusedStack::RunTest( UINT32 & rErrorCode )
+    {
+	    ConfigForAnyNewDiagCycle( this );
+
+	    while ( m_ProcessId < MAX_PROCS )
+	    {
+	        // The NULL task's stack is not zero filled, process IDs not in use have no stack.
+	        if ( ( NULL_ID == m_ProcessId ) || ( NULL == proc_id_index[ m_ProcessId ] ) )
+	        {
+	            ++m_ProcessId;
+
+	            continue;
+	        }
+
+	        if ( !m_StackScanned )
+	        {
+	            ScanUnusedStack( m_ProcessId );
+	        }
+
+	        BOOL     taskCompleted = FALSE;
+
+	        UINT32 * pFailedWord   = NULL;
+
+		    BOOL     hadSuccess    = TestUnusedStack( m_ProcessId, taskCompleted, pFailedWord );
+
+		    if ( !hadSuccess )
+		    {
+		        UINT32 * pStackBottom = reinterpret_cast<UINT32 *>( stack.proc_start[ m_ProcessId ] )
+		                                - ( stack.proc_size[ m_ProcessId ] - 1 );
+
+		 	    EncodeErrorInfo( rErrorCode, m_ProcessId, pFailedWord - pStackBottom );
+
+		 	    OS_Assert( rErrorCode );
+		    }
+
+		    if ( taskCompleted )
+		    {
+		        ++m_ProcessId;
+
+		        m_StackScanned    = FALSE;
+
+		        m_NmbrWordsTested = 0;
+		    }
+
+		    return DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
+	    }
+
+	    return DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: ScanUnusedStack
+    ///
+    ///      Finds the untouched part of a task's stack, records the margin and sets the words to test
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::ScanUnusedStack( UINT32 processId )
+    {
+        m_StackScanned    = TRUE;
+
+        m_NmbrWordsToTest = 0;
+
+        if ( stack.proc_size[ processId ] <= 1 )
+        {
+            return;
+        }
+
+        UINT32 *                pStackTop          = reinterpret_cast<UINT32 *>( stack.proc_start[ processId ] );
+
+        // OS_CreateTask() zero fills all but the top word.
+        UINT32                  nmbrStackWords     = stack.proc_size[ processId ] - 1;
+
+        UINT32 *                pStackBottom       = pStackTop - nmbrStackWords;
+
+        const volatile UINT32 * pWords             = pStackBottom;
+
+        UINT32                  nmbrUntouchedWords = 0;
+
+        //
+        // Interrupts are enabled, the task can grow its stack while it is scanned.  Each critical section checks the
+        // words it tests still hold zero.
+        //
+        while ( ( nmbrUntouchedWords < nmbrStackWords ) && ( 0 == pWords[ nmbrUntouchedWords ] ) )
+        {
+            ++nmbrUntouchedWords;
+        }
+
+        RecordMargin( processId, nmbrStackWords, nmbrUntouchedWords );
+
+        //
+        // When the test runs on this stack the words its own calls push below the stack pointer are not tested.
+        //
+        UINT32                  nmbrWordsToTest    = nmbrUntouchedWords;
+
+        UINT32 *                pStackLocation     = reinterpret_cast<UINT32 *>( &nmbrWordsToTest );
+
+        if ( ( pStackLocation >= pStackBottom ) && ( pStackLocation < pStackTop ) )
+        {
+            UINT32 nmbrWordsBelowTest = pStackLocation - pStackBottom;
+
+            nmbrWordsBelowTest        = ( nmbrWordsBelowTest > UNUSED_STACK_GUARD_WORDS )
+                                        ? ( nmbrWordsBelowTest - UNUSED_STACK_GUARD_WORDS ) : 0;
+
+            if ( nmbrWordsToTest > nmbrWordsBelowTest )
+            {
+                nmbrWordsToTest = nmbrWordsBelowTest;
+            }
+        }
+
+        m_NmbrWordsToTest = nmbrWordsToTest;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: TestUnusedStack
+    ///
+    ///      Tests the next words of the untouched part of a task's stack that still hold zero
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagUnusedStack::TestUnusedStack( UINT32 processId, BOOL & rTaskCompleted, UINT32 * & rpFailedWord )
+    {
+        BOOL     testPassed     = TRUE;
+
+        rTaskCompleted          = TRUE;
+
+        if ( m_NmbrWordsTested >= m_NmbrWordsToTest )
+        {
+            return testPassed;
+        }
+
+        UINT32   nmbrWords      = m_NmbrWordsToTest - m_NmbrWordsTested;
+
+        if ( nmbrWords > m_NmbrWordsToTestPerIteration )
+        {
+            nmbrWords = m_NmbrWordsToTestPerIteration;
+        }
+
+        if ( nmbrWords > m_TimingStatistics.m_WordsPerCriticalSection )
+        {
+            nmbrWords = m_TimingStatistics.m_WordsPerCriticalSection;
+        }
+
+        UINT32   nmbrStackWords = m_StackMargins[ processId ].m_NmbrStackWords;
+
+        UINT32   nmbrZeroWords  = 0;
+
+        DisableInterrupts();
+
+        //
+        // The task may have been deleted, or another created with a different stack, since the stack was scanned.
+        // Nothing else runs until interrupts are enabled, so the words found holding zero stay untouched while they
+        // are tested.
+        //
+        BOOL     stackUnchanged = ( NULL != proc_id_index[ processId ] )
+                                  && ( ( stack.proc_size[ processId ] - 1 ) == nmbrStackWords );
+
+        if ( stackUnchanged )
+        {
+            UINT32 *                pFirstWord = reinterpret_cast<UINT32 *>( stack.proc_start[ processId ] )
+                                                 - nmbrStackWords + m_NmbrWordsTested;
+
+            const volatile UINT32 * pWords     = pFirstWord;
+
+            while ( ( nmbrZeroWords < nmbrWords ) && ( 0 == pWords[ nmbrZeroWords ] ) )
+            {
+                ++nmbrZeroWords;
+            }
+
+            if ( nmbrZeroWords > 0 )
+            {
+                testPassed = TestZeroWords( pFirstWord, nmbrZeroWords, rpFailedWord );
+            }
+        }
+
+        UINT32   cycles         = EnableInterrupts();
+
+        if ( nmbrZeroWords > 0 )
+        {
+            UpdateTiming( cycles, nmbrZeroWords );
+        }
+
+        if ( !stackUnchanged )
+        {
+            return testPassed;
+        }
+
+        // The task grew its stack into the words since it was scanned.
+        if ( nmbrZeroWords < nmbrWords )
+        {
+            m_NmbrWordsToTest = m_NmbrWordsTested + nmbrZeroWords;
+
+            RecordMargin( processId, nmbrStackWords, m_NmbrWordsToTest );
+        }
+
+        m_NmbrWordsTested += nmbrZeroWords;
+
+        rTaskCompleted     = ( m_NmbrWordsTested >= m_NmbrWordsToTest );
+
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: TestZeroWords
+    ///
+    ///      Writes each test pattern over words holding zero and reads it back, then writes zero back
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagUnusedStack::TestZeroWords( UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord )
+    {
+        volatile UINT32 * pWords     = pFirstWord;
+
+        BOOL              testPassed = TRUE;
+
+        for ( UINT32 pattern = 0; testPassed && ( pattern < m_NmbrTestPatterns ); ++pattern )
+        {
+            UINT32 testPattern = m_pTestPatterns[ pattern ];
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                pWords[ ui ] = testPattern;
+            }
+
+            for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+            {
+                if ( pWords[ ui ] != testPattern )
+                {
+                    rpFailedWord = pFirstWord + ui;
+
+                    testPassed   = FALSE;
+
+                    break;
+                }
+            }
+        }
+
+        // The words held zero before the test, so zero is all there is to restore.
+        for ( UINT32 ui = 0; ui < nmbrWords; ++ui )
+        {
+            pWords[ ui ] = 0;
+        }
+
+        return testPassed;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: UpdateTiming
+    ///
+    ///      Keeps the most cycles measured for one word and per word past the first and sizes the next critical
+    ///      section from them
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::UpdateTiming( UINT32 cycles, UINT32 nmbrWords )
+    {
+        UnusedStackTimingStatistics & rTiming = m_TimingStatistics;
+
+        if ( 1 == nmbrWords )
+        {
+            if ( cycles > rTiming.m_OneWordCycles )
+            {
+                rTiming.m_OneWordCycles = cycles;
+            }
+        }
+        else
+        {
+            UINT32 cyclesPerWord = 0;
+
+            if ( 0 == rTiming.m_OneWordCycles )
+            {
+                // Only when critical sections are not limited, the fixed cost is charged to the words.
+                cyclesPerWord = ( cycles + nmbrWords - 1 ) / nmbrWords;
+            }
+            else if ( cycles > rTiming.m_OneWordCycles )
+            {
+                cyclesPerWord = ( cycles - rTiming.m_OneWordCycles + nmbrWords - 2 ) / ( nmbrWords - 1 );
+            }
+
+            if ( cyclesPerWord > rTiming.m_CyclesPerWord )
+            {
+                rTiming.m_CyclesPerWord = cyclesPerWord;
+            }
+        }
+
+        UINT32 nmbrWordsThatFit = m_NmbrWordsToTestPerIteration;
+
+        if ( m_MaxCriticalSectionCycles > 0 )
+        {
+            if ( ( 0 == rTiming.m_OneWordCycles ) || ( rTiming.m_OneWordCycles >= m_MaxCriticalSectionCycles ) )
+            {
+                nmbrWordsThatFit = 1;
+            }
+            else if ( 0 == rTiming.m_CyclesPerWord )
+            {
+                // No word costs more than a critical section of one word, the fixed cost included.
+                nmbrWordsThatFit = m_MaxCriticalSectionCycles / rTiming.m_OneWordCycles;
+            }
+            else
+            {
+                nmbrWordsThatFit = 1 + ( ( m_MaxCriticalSectionCycles - rTiming.m_OneWordCycles ) / rTiming.m_CyclesPerWord );
+            }
+        }
+
+        rTiming.m_WordsPerCriticalSection = ( nmbrWordsThatFit < m_NmbrWordsToTestPerIteration )
+                                            ? nmbrWordsThatFit : m_NmbrWordsToTestPerIteration;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: RecordMargin
+    ///
+    ///      Keeps the number of untouched words found for a task's stack and the fewest found
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::RecordMargin( UINT32 processId, UINT32 nmbrStackWords, UINT32 nmbrUntouchedWords )
+    {
+        StackMargin & rMargin = m_StackMargins[ processId ];
+
+        // A task created with a different stack since the margin was last recorded starts over.
+        if ( ( rMargin.m_NmbrStackWords != nmbrStackWords ) || ( nmbrUntouchedWords < rMargin.m_FewestUntouchedWords ) )
+        {
+            rMargin.m_FewestUntouchedWords = nmbrUntouchedWords;
+        }
+
+        rMargin.m_NmbrStackWords     = nmbrStackWords;
+
+        rMargin.m_NmbrUntouchedWords = nmbrUntouchedWords;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: EncodeErrorInfo
+    ///
+    ///      Encoding information about a test failure
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 processId, UINT32 wordOffset )
+    {
+        rErrorInfo  = GetTestType() << DIAG_ERROR_TYPE_BIT_POS;
+
+        rErrorInfo |= processId << UNUSED_STACK_TASK_ID_BIT_POS;
+
+        rErrorInfo |= wordOffset & UNUSED_STACK_WORD_OFFSET_ERROR_MASK;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: ConfigureForNextTestCycle
+    ///
+    ///      Provides interface specified by the pure virtual method in the base class. This method is called
+    ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+    ///      initialized for an individual test is initialized.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::ConfigureForNextTestCycle()
+    {
+        m_ProcessId       = 0;
+
+        m_StackScanned    = FALSE;
+
+        m_NmbrWordsTested = 0;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: GetStackMargin
+    ///
+    ///      Get the high-water margin found for a task's stack
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL BlackfinDiagUnusedStack::GetStackMargin( UINT32 processId, StackMargin & rMargin )
+    {
+        if ( ( processId >= MAX_PROCS ) || ( 0 == m_StackMargins[ processId ].m_NmbrStackWords ) )
+        {
+            return FALSE;
+        }
+
+        rMargin = m_StackMargins[ processId ];
+
+        return TRUE;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: BlackfinDiagUnusedStack: GetTimingStatistics
+    ///
+    ///      Get the timing measured testing the unused stacks
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void BlackfinDiagUnusedStack::GetTimingStatistics( UnusedStackTimingStatistics & rStatistics )
+    {
+        rStatistics = m_TimingStatistics;
+    }
+
+	UINT32 BlackfinDiagUnusedStack::EnableInterrupts()
+	{
+	    UINT64 timestamp = 0;
+
+	    _GET_CYCLE_COUNT( timestamp );
+
+		sti(m_Critical);
+
+		UINT32 cycles = static_cast<UINT32>( timestamp - m_CriticalSectionStart );
+
+		if ( cycles > m_TimingStatistics.m_WorstCriticalSectionCycles )
+		{
+			m_TimingStatistics.m_WorstCriticalSectionCycles = cycles;
+		}
+
+		return cycles;
+	}
+
+	void BlackfinDiagUnusedStack::DisableInterrupts()
+	{
+		m_Critical = cli();
+
+		_GET_CYCLE_COUNT( m_CriticalSectionStart );
+	}
+
+}
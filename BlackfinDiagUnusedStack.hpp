@@ -0,0 +1,344 @@
+/// #pragma once
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagUnusedStack.hpp
+///
+/// Namespace for the unused stack diagnostic test
+///
+/// @par Full Description
+///
+/// Diagnostic testing for the part of each task's stack the task has never used.  OS_CreateTask() zero fills a
+/// task's stack and the stack grows down from its top, so the words from the bottom of the stack up to the lowest
+/// word that is not zero have never been written since the task was created.  Those words hold zero, so they are
+/// tested without saving them: with interrupts disabled each test pattern is written and read back and zero is
+/// written back.  The untouched part of a task's stack is found once a diagnostic cycle, with interrupts enabled, before
+/// the first of its words is tested.  The task can grow its stack after that, so each critical section first checks
+/// the words it is to test still hold zero and stops short of the first that does not.  The number of untouched words
+/// found is the task's high-water margin, the fewest seen for each task is kept so it can be reported.  Critical
+/// sections are kept within a number of cycles the way the data RAM and SDRAM tests keep them, sized from the cycles
+/// measured for a window of one word and per word past the first.
+///
+/// The NULL task runs on the stack main() started on, which is not zero filled, so it is not tested.  A task given the
+/// stack of a deleted task is only zero filled for the size it asked for, so its margin reads low.  The words just
+/// below the stack pointer of the test itself are not tested.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(BLACKFIN_DIAG_UNUSED_STACK_HPP)
+#define BLACKFIN_DIAG_UNUSED_STACK_HPP
+
+// SYSTEM INCLUDES
+
+// C PROJECT INCLUDES
+#include <ccblkfn.h>                              /* cli/sti( ) */
+#include "Os_iotk.h"                              /* MAX_PROCS */
+
+// C++ PROJECT INCLUDES
+#include "DiagnosticTesting.hpp"
+
+// FORWARD REFERENCES
+// (none)
+
+namespace BlackfinDiagnosticTesting
+{
+    static const UINT32 UNUSED_STACK_TASK_ID_BIT_POS        = 16;      // Process ID of the task whose stack failed
+    static const UINT32 UNUSED_STACK_WORD_OFFSET_ERROR_MASK = 0xffff;  // Offset in words from the bottom of the stack
+    static const UINT32 UNUSED_STACK_GUARD_WORDS            = 0x40;    // Below the test's own stack pointer, not tested
+
+    class BlackfinDiagUnusedStack : public DiagnosticTesting::DiagnosticTest
+    {
+        public:
+
+            // High-water margin of a task's stack.
+            typedef struct
+            {
+    	        UINT32           m_NmbrStackWords;              // Zero filled by OS_CreateTask(), 0 when not tested
+    	        UINT32           m_NmbrUntouchedWords;          // Found the last time the stack was tested
+    	        UINT32           m_FewestUntouchedWords;        // Fewest found since the task was created
+            }
+            StackMargin;
+
+            // Timing measured testing the unused stacks, for tuning the critical section length.
+            typedef struct
+            {
+                UINT32           m_OneWordCycles;               // Most measured for a critical section of one word
+                UINT32           m_CyclesPerWord;               // Most measured per word past the first
+                UINT32           m_WordsPerCriticalSection;     // Words the next critical section will test at most
+                UINT32           m_WorstCriticalSectionCycles;
+            }
+            UnusedStackTimingStatistics;
+
+	        //***************************************************************************
+            // PUBLIC METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: BlackfinDiagUnusedStack
+            ///
+            /// @par Full Description
+            ///      Construction that is used to construct the BlackfinDiagUnusedStack object that is used to test the
+            ///      unused part of the task stacks.  It is derived from the DiagnosticTesting::DiagnosticTest base
+            ///      class.
+            ///
+            ///
+            /// @param pTestPatterns                The array of 32 bit test patterns written over the unused words.
+            ///        nmbrTestPatterns             Size of the the array of test patterns.
+            ///        nmbrWordsToTestPerIteration  Number of words of a stack tested per iteration of the test, all in
+            ///                                     one critical section.
+            ///        maxCriticalSectionCycles     Most cycles interrupts are to be disabled for at a time, 0 for no
+            ///                                     limit.  A single word is always tested at once.
+            ///        ExecuteTestData              Initial runtime data passed to the base for running this test.
+            ///
+            /// @return                             Blackfin unused stack diagnostic instance created.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BlackfinDiagUnusedStack( const UINT32 *              pTestPatterns,
+	                                 UINT32                      nmbrTestPatterns,
+	                                 UINT32                      nmbrWordsToTestPerIteration,
+	                                 UINT32                      maxCriticalSectionCycles,
+		    		                 DiagnosticTesting::DiagnosticTest::ExecuteTestData &     rTestData )
+						    :  DiagnosticTesting::DiagnosticTest ( rTestData ),
+							   m_pTestPatterns                   ( pTestPatterns ),
+							   m_NmbrTestPatterns                ( nmbrTestPatterns ),
+	                       	   m_NmbrWordsToTestPerIteration     ( nmbrWordsToTestPerIteration ),
+							   m_MaxCriticalSectionCycles        ( maxCriticalSectionCycles ),
+							   m_CriticalSectionStart            ( 0 ),
+	                       	   m_ProcessId                       ( 0 ),
+	                       	   m_StackScanned                    ( FALSE ),
+	                       	   m_NmbrWordsToTest                 ( 0 ),
+	                       	   m_NmbrWordsTested                 ( 0 )
+	        {
+	            m_TimingStatistics.m_OneWordCycles              = 0;
+	            m_TimingStatistics.m_CyclesPerWord              = 0;
+	            m_TimingStatistics.m_WordsPerCriticalSection    = ( 0 == maxCriticalSectionCycles ) ? nmbrWordsToTestPerIteration : 1;
+	            m_TimingStatistics.m_WorstCriticalSectionCycles = 0;
+
+	            for ( UINT32 ui = 0; ui < MAX_PROCS; ++ui )
+	            {
+	                m_StackMargins[ ui ].m_NmbrStackWords       = 0;
+	                m_StackMargins[ ui ].m_NmbrUntouchedWords   = 0;
+	                m_StackMargins[ ui ].m_FewestUntouchedWords = 0;
+	            }
+	        }
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: RunTest
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class.  The scheduler calls
+            ///      this method to run iterations of the diagnostic test.
+            ///
+            ///
+            /// @param                            Reference to a possible error code returned from the scheduler.
+            ///
+            /// @return                           Status of executing a test
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        DiagnosticTest::TestState RunTest( UINT32 & rErrorCode  );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: GetStackMargin
+            ///
+            /// @par Full Description
+            ///      Get the high-water margin found for a task's stack.
+            ///
+            ///
+            /// @param      processId             Process ID of the task.
+            ///             rMargin               Filled in with the margin.
+            ///
+            /// @return                           FALSE when the task's stack has not been tested
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL GetStackMargin( UINT32 processId, StackMargin & rMargin );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: GetTimingStatistics
+            ///
+            /// @par Full Description
+            ///      Get the timing measured testing the unused stacks since the test was constructed.
+            ///
+            ///
+            /// @param      rStatistics           Filled in with the timing.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void GetTimingStatistics( UnusedStackTimingStatistics & rStatistics );
+
+        protected:
+
+	        //***************************************************************************
+            // PROTECTED METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: ConfigureForNextTestCycle
+            ///
+            /// @par Full Description
+            ///      Provides interface specified by the pure virtual method in the base class. This method is called
+            ///      at that start of testing for the test during a new diagnostics cycle. The data that needs to be
+            ///      initialized for an individual test is initialized.
+            ///
+            /// @param                            None.
+            ///
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ConfigureForNextTestCycle();
+
+        private:
+
+	        //
+	        // Inhibit copy construction and assignments of this class by putting the declarations in private portion.
+	        // If using C++ 11 and later use the delete keyword to do this.
+	        //
+	        BlackfinDiagUnusedStack(const BlackfinDiagUnusedStack &);
+
+	        const BlackfinDiagUnusedStack & operator = (const BlackfinDiagUnusedStack & );
+
+            BlackfinDiagUnusedStack();
+
+            // For saving status of processor when interrupts are disabled and restoring the state when re-enabling.
+            INT                        m_Critical;
+
+	        // The test pattern array
+	        const UINT32 *             m_pTestPatterns;
+
+	        // Number of test patterns in the test pattern array.
+	        UINT32                     m_NmbrTestPatterns;
+
+	        // Number of words of a stack to test per iteration of the test.
+	        UINT32                     m_NmbrWordsToTestPerIteration;
+
+	        // Most cycles interrupts are to be disabled for at a time, 0 for no limit.
+	        UINT32                     m_MaxCriticalSectionCycles;
+
+	        // Cycle count when interrupts were last disabled.
+	        UINT64                     m_CriticalSectionStart;
+
+	        // Timing measured so far.
+	        UnusedStackTimingStatistics m_TimingStatistics;
+
+	        // Process ID of the task whose stack is being tested.
+	        UINT32                     m_ProcessId;
+
+	        // TRUE once the untouched part of that stack has been found this diagnostic cycle.
+	        BOOL                       m_StackScanned;
+
+	        // Words up from the bottom of that stack to test, found untouched less those below the test's own stack.
+	        UINT32                     m_NmbrWordsToTest;
+
+	        // Words tested up from the bottom of that stack this diagnostic cycle.
+	        UINT32                     m_NmbrWordsTested;
+
+	        // High-water margin of each task's stack, indexed by process ID.
+	        StackMargin                m_StackMargins[ MAX_PROCS ];
+
+            inline void DisableInterrupts();
+
+	        inline UINT32 EnableInterrupts();
+
+	        //***************************************************************************
+            // PRIVATE METHODS
+            //***************************************************************************
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: ScanUnusedStack
+            ///
+            /// @par Full Description
+            ///      With interrupts enabled finds the untouched part of a task's stack, records the margin and sets the
+            ///      words to test this diagnostic cycle.
+            ///
+            /// @param        processId       Process ID of the task.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        void ScanUnusedStack( UINT32 processId );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: TestUnusedStack
+            ///
+            /// @par Full Description
+            ///      With interrupts disabled tests the next words of the untouched part of a task's stack that still
+            ///      hold zero.
+            ///
+            /// @param        processId       Process ID of the task.
+            ///               rTaskCompleted  Set TRUE when all of the untouched part has been tested.
+            ///               rpFailedWord    Upon failure the word where the test failed
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestUnusedStack( UINT32 processId, BOOL & rTaskCompleted, UINT32 * & rpFailedWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: TestZeroWords
+            ///
+            /// @par Full Description
+            ///      Writes each test pattern over words holding zero and reads it back, then writes zero back.  Called
+            ///      with interrupts disabled.
+            ///
+            /// @param        pFirstWord      First word to test.
+            ///               nmbrWords       Number of words to test.
+            ///               rpFailedWord    Upon failure the word where the test failed
+            ///
+            /// @return       TRUE when test passes
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL TestZeroWords( UINT32 * pFirstWord, UINT32 nmbrWords, UINT32 * & rpFailedWord );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: UpdateTiming
+            ///
+            /// @par Full Description
+            ///      Keeps the most cycles measured for a critical section of one word and per word past the first, and
+            ///      sizes the next critical section from them.
+            ///
+            /// @param        cycles          Length of the critical section just measured.
+            ///               nmbrWords       Words tested in the critical section.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void UpdateTiming( UINT32 cycles, UINT32 nmbrWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: RecordMargin
+            ///
+            /// @par Full Description
+            ///      Keeps the number of untouched words found for a task's stack and the fewest found.
+            ///
+            /// @param        processId          Process ID of the task.
+            ///               nmbrStackWords     Words of the stack zero filled by OS_CreateTask().
+            ///               nmbrUntouchedWords Words found untouched.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void RecordMargin( UINT32 processId, UINT32 nmbrStackWords, UINT32 nmbrUntouchedWords );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: BlackfinDiagUnusedStack: EncodeErrorInfo
+            ///
+            /// @par Full Description
+            ///      Encoding information about a test failure
+            ///
+            /// @param        rErrorInfo          A reference for passing back error info to the caller.
+            ///               processId           Process ID of the task whose stack failed.
+            ///               wordOffset          Offset in words from the bottom of the stack of the failed word.
+            ///
+            /// @return       None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void EncodeErrorInfo( UINT32 & rErrorInfo, UINT32 processId, UINT32 wordOffset );
+    };
+};
+
+#endif //!defined(BLACKFIN_DIAG_UNUSED_STACK_HPP)
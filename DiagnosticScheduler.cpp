@@ -88,6 +88,8 @@ namespace DiagnosticScheduling
     	m_TimeTestCycleStarted           = m_TimestampCurrent;
 		
     	m_TimeLastIterationPeriodExpired = m_TimestampCurrent;		
+    	
+    	ResetSchedulerStatistics();
     }
 
 
@@ -114,17 +116,34 @@ namespace DiagnosticScheduling
     	// Then check if it's time for generic diagnostic test (unsigned math handles roll-over)
     	//else if ((GetSystemTime() - m_LastDiagTime) > DiagnosticSlicePeriod_Microseconds)
     
+    	UINT64 timestampEntered = (*m_RuntimeData.m_SysTimestamp)();
+    	
     	DetermineCurrentSchedulerState();	
+    	
+    	m_Statistics.m_TicksDeterminingState += ( (*m_RuntimeData.m_SysTimestamp)() - timestampEntered );
+    	
+    	++m_Statistics.m_NumberOfCallsEndingInState[ m_CurrentSchedulerState ];
+    	
+    	++m_Statistics.m_NumberOfRunScheduledCalls;
 
     	switch (m_CurrentSchedulerState) 
         {
     		case MAX_PERIOD_EXPIRED_ALL_TESTS_COMPLETE:		
+    		case ALL_TESTS_COMPLETE_NEXT_CYCLE_STARTED:		
     		{
     			m_CurrentSchedulerState = NO_NEW_SCHEDULING_PERIOD;
 			
     	        for ( UINT32 ui = 0; ui < m_NumberOfDiagTests; ui++ )
     	        {			
         		    m_ppRunTimeDiagnostics[ ui ]->SetNumberOfTimesRanThisDiagCycle(0);
+        		    
+        		    // Pause time is accounted per diagnostic cycle, a pause in progress is counted from now on.
+        		    m_ppRunTimeDiagnostics[ ui ]->SetTimePausedThisDiagCycle(0);
+        		    
+        		    if ( m_ppRunTimeDiagnostics[ ui ]->IsTestPaused() )
+        		    {
+        		        m_ppRunTimeDiagnostics[ ui ]->SetPauseStartTimestamp( m_TimestampCurrent );
+        		    }
     	        }
 			}
 		
@@ -153,9 +172,117 @@ namespace DiagnosticScheduling
     		case NO_NEW_SCHEDULING_PERIOD:
     		case NO_TESTS_TO_RUN_ALL_COMPLETED:
     		case NO_TEST_ITERATIONS_SCHEDULED:
+    		case NUMBER_OF_SCHEDULER_STATES:
 		
     		break;
     	}
+    	
+    	m_Statistics.m_TicksInRunScheduled += ( (*m_RuntimeData.m_SysTimestamp)() - timestampEntered );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: GetSchedulerStatistics
+    ///
+    /// Get the measurements of the time spent in the scheduler.
+    ///
+    /////////////////////////////////////////////////////////////////////////// 
+    template <typename T>
+    void DiagnosticScheduler<T>::GetSchedulerStatistics( SchedulerStatistics & rStatistics )
+    {
+        rStatistics = m_Statistics;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: ResetSchedulerStatistics
+    ///
+    /// Clear the measurements of the time spent in the scheduler.
+    ///
+    /////////////////////////////////////////////////////////////////////////// 
+    template <typename T>
+    void DiagnosticScheduler<T>::ResetSchedulerStatistics()
+    {
+        m_Statistics.m_TicksInRunScheduled       = 0;
+        
+        m_Statistics.m_TicksDeterminingState     = 0;
+        
+        m_Statistics.m_TicksRunningTests         = 0;
+        
+        m_Statistics.m_NumberOfRunScheduledCalls = 0;
+        
+    	for ( UINT32 ui = 0; ui < NUMBER_OF_SCHEDULER_STATES; ++ui )
+    	{
+    	    m_Statistics.m_NumberOfCallsEndingInState[ ui ] = 0;
+    	}
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: PauseTest
+    ///
+    /// Pause the tests of the test type indicated.
+    ///
+    /////////////////////////////////////////////////////////////////////////// 
+    template <typename T>
+    BOOL DiagnosticScheduler<T>::PauseTest( UINT32 testType )
+    {
+        BOOL   testFound = FALSE;
+        
+        UINT64 timestamp = (*m_RuntimeData.m_SysTimestamp)();
+        
+    	for ( UINT32 ui = 0; ui < m_NumberOfDiagTests; ++ui )
+    	{
+    	    T * pDiagTest = m_ppRunTimeDiagnostics[ ui ];
+    	    
+    	    if ( pDiagTest->GetTestType() != testType )
+    	    {
+    	        continue;
+    	    }
+    	    
+    	    testFound = TRUE;
+    	    
+    	    if ( !pDiagTest->IsTestPaused() )
+    	    {
+    	        pDiagTest->SetPauseStartTimestamp( timestamp );
+    	        
+    	        pDiagTest->SetTestPaused( TRUE );
+    	    }
+    	}
+    	
+    	return testFound;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: ResumeTest
+    ///
+    /// Resume the tests of the test type indicated that were paused.
+    ///
+    /////////////////////////////////////////////////////////////////////////// 
+    template <typename T>
+    BOOL DiagnosticScheduler<T>::ResumeTest( UINT32 testType )
+    {
+        BOOL   testFound = FALSE;
+        
+        UINT64 timestamp = (*m_RuntimeData.m_SysTimestamp)();
+        
+    	for ( UINT32 ui = 0; ui < m_NumberOfDiagTests; ++ui )
+    	{
+    	    T * pDiagTest = m_ppRunTimeDiagnostics[ ui ];
+    	    
+    	    if ( pDiagTest->GetTestType() != testType )
+    	    {
+    	        continue;
+    	    }
+    	    
+    	    testFound = TRUE;
+    	    
+    	    if ( pDiagTest->IsTestPaused() )
+    	    {
+    	        pDiagTest->SetTimePausedThisDiagCycle( ComputeTimePaused( pDiagTest, timestamp ) );
+    	        
+    	        pDiagTest->SetTestPaused( FALSE );
+    	    }
+    	}
+    	
+    	return testFound;
     }
 
     //***************************************************************************
@@ -186,6 +313,59 @@ namespace DiagnosticScheduling
     	return allTestsCompleted;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: ComputePausedTimeAllowance
+    ///
+    ///      Compute the time the diagnostic cycle is extended by because incomplete tests were paused.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    UINT32 DiagnosticScheduler<T>::ComputePausedTimeAllowance()
+    { 
+    	UINT32 allowance = 0;
+    	
+    	for ( UINT32 ui = 0; ui < m_NumberOfDiagTests; ++ui )
+    	{
+            if ( IsTestingCompleteForDiagCycle(m_ppRunTimeDiagnostics[ ui ]) )
+            {	
+                continue;
+            }
+            
+            UINT32 timePaused = ComputeTimePaused( m_ppRunTimeDiagnostics[ ui ], m_TimestampCurrent );
+            
+            if ( timePaused > allowance )
+            {
+                allowance = timePaused;
+            }
+    	}
+    	
+    	return allowance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: ComputeTimePaused
+    ///
+    ///      Compute the bounded time a test has been paused this diagnostic cycle.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    UINT32 DiagnosticScheduler<T>::ComputeTimePaused( T * & rpPbdt, UINT64 timestamp )
+    { 
+    	UINT32 timePaused = rpPbdt->GetTimePausedThisDiagCycle();
+    	
+    	if ( rpPbdt->IsTestPaused() )
+    	{
+    	    timePaused += (*m_RuntimeData.m_CalcElapsedTime)( timestamp, rpPbdt->GetPauseStartTimestamp() );
+    	}
+    	
+    	if ( timePaused > m_RuntimeData.m_MaxTestPauseTimeMS )
+    	{
+    	    timePaused = m_RuntimeData.m_MaxTestPauseTimeMS;
+    	}
+    	
+    	return timePaused;
+    }
+
     /////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnositcScheduler: ConfigureErrorCode
     ///
@@ -242,6 +422,18 @@ namespace DiagnosticScheduling
 
  			m_TimeLastIterationPeriodExpired = m_TimestampCurrent;
 	    	
+    	    // In continuous coverage the next diagnostic cycle starts as soon as the current one completes.
+    	    if ( allTestsCompleted && m_RuntimeData.m_StartNextCycleWhenComplete )
+    	    {
+    		    m_TimeTestCycleStarted = m_TimestampCurrent;
+    		
+                ++m_NumberOfDiagCycles;
+                
+    	        m_CurrentSchedulerState = ALL_TESTS_COMPLETE_NEXT_CYCLE_STARTED;
+    	        
+    	        return;
+    	    }
+    	    
     	    if ( NO_TESTS_TO_RUN_ALL_COMPLETED == m_CurrentSchedulerState ) 
             {
 	            return;
@@ -280,6 +472,8 @@ namespace DiagnosticScheduling
     	{
 		    if ( 
     		        !IsTestingCompleteForDiagCycle(m_ppRunTimeDiagnostics[ ui ])
+    		     && !IsTestHeldByPause(m_ppRunTimeDiagnostics[ ui ])
+    		     && !IsTestHeldByPrerequisites(m_ppRunTimeDiagnostics[ ui ])
     		     && IsTestScheduledToRun(m_ppRunTimeDiagnostics[ ui ]) 
     		   )
     		{
@@ -317,80 +511,79 @@ namespace DiagnosticScheduling
     		    continue;
     		}
 		
+    		if ( IsTestHeldByPause(pCurrentDiagTest) ) 
+    		{
+    		    continue;
+    		}
+		
+    		if ( IsTestHeldByPrerequisites(pCurrentDiagTest) ) 
+    		{
+    		    continue;
+    		}
+		
     		if ( !IsTestScheduledToRun(pCurrentDiagTest) ) 
     		{
     		    continue;
     		}
 									
-    		T::TestState CurrentState = pCurrentDiagTest->GetCurrentTestState();
+    		typename T::TestState CurrentState = pCurrentDiagTest->GetCurrentTestState();
     		    
     		if ( CurrentState == T::TEST_LOOP_COMPLETE )
     		{
     		    pCurrentDiagTest->SetTestStartTime( m_TimestampCurrent );
-    		}    		    
     		    
-    		UINT32	returnedErrorCode;
-
-    		T::TestState testResult = pCurrentDiagTest->RunTest( returnedErrorCode );
-
-        	pCurrentDiagTest->SetCurrentTestState( testResult );
-    
-        	pCurrentDiagTest->SetIterationCompletedTimestamp( m_TimestampCurrent );
-		
-    		switch (testResult)
+    		    pCurrentDiagTest->SetTimePausedAtTestStart( ComputeTimePaused( pCurrentDiagTest, m_TimestampCurrent ) );
+    		}    		    
+    		
+    		// Sample the idle indication now so the batch only continues while nothing else runs during it.
+    		(*m_RuntimeData.m_IsSystemIdle)();
+    		
+    		UINT64 batchStartTimestamp = m_TimestampCurrent;
+    		
+    		UINT32 iterationsRan       = 0;
+    		
+    		do 
     		{
-    		    case T::TEST_LOOP_COMPLETE: 
-        			{
-        			    if ( m_RuntimeData.m_MonitorIndividualTotalTestingTime ) 
-        			    {
-        			        UINT64  clk = pCurrentDiagTest->GetTestCompletedTimestamp();
-    			        
-                            UINT32 elapsedTime = (*m_RuntimeData.m_CalcElapsedTime)( m_TimestampCurrent, clk );
-                            
-                            UINT32 prevElapsedTime = pCurrentDiagTest->GetMaxTimeBetweenTestCompletions();
-                            
-                            if ( elapsedTime > prevElapsedTime )
-                            {
-                                pCurrentDiagTest->SetMaxTimeBetweenTestCompletions( elapsedTime );
-                            }
-                            
-                            pCurrentDiagTest->SetTestCompletedTimestamp( m_TimestampCurrent );
-                            
-        		        }      
-    				
-                        UINT32 numberOfTimesRan = pCurrentDiagTest->GetNumberOfTimesRanThisDiagCycle();
-	
-        	            ++numberOfTimesRan;
-	
-        	            pCurrentDiagTest->SetNumberOfTimesRanThisDiagCycle( numberOfTimesRan );
-        			}
-    					
-        			break;
-			
-    			case T::TEST_IN_PROGRESS:
-    				
-    			    if ( m_RuntimeData.m_MonitorIndividualTestIterationTimes )
-    				{
-    				    UINT64 clk = pCurrentDiagTest->GetTestStartTime();
-    				        
-    				    UINT32 elapsedTime = (*m_RuntimeData.m_CalcElapsedTime)( m_TimestampCurrent, clk );
-    				        
-    				    pCurrentDiagTest->SetCurrentIterationDuration( elapsedTime );
-    				}
-	
-    				break;
-
-    			default:
-    				
-    				ConfigureErrorCode( returnedErrorCode, pCurrentDiagTest->GetTestType() );
-		
-    				(*m_RuntimeData.m_ExceptionError)( returnedErrorCode );
-			
-    				break;
+    		    RunTestIteration( pCurrentDiagTest );
+    		    
+    		    ++iterationsRan;
     		}
+    		while ( IsAnotherBatchIterationAllowed( pCurrentDiagTest, iterationsRan, batchStartTimestamp ) );
     	}
     }    
 			
+    /////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: IsAnotherBatchIterationAllowed
+    ///
+    /// Returns TRUE when another iteration of the test can be run in the same
+    /// scheduling period because the system is idle.
+    ///      
+    /////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    BOOL DiagnosticScheduler<T>::IsAnotherBatchIterationAllowed( T * &  rpPbdt, 
+                                                                 UINT32 iterationsRan,
+                                                                 UINT64 batchStartTimestamp ) 
+    {
+        if ( rpPbdt->GetCurrentTestState() != T::TEST_IN_PROGRESS )
+        {
+            return FALSE;
+        }
+        
+        if ( iterationsRan >= rpPbdt->GetMaxIterationsPerBatch() )
+        {
+            return FALSE;
+        }
+        
+        if ( !(*m_RuntimeData.m_IsSystemIdle)() )
+        {
+            return FALSE;
+        }
+        
+    	m_TimestampCurrent = (*m_RuntimeData.m_SysTimestamp)();
+    	
+    	return ( ( m_TimestampCurrent - batchStartTimestamp ) < m_RuntimeData.m_IdleBatchTickBudget );
+    }
+    
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnositcScheduler: IsDiagnosticCyleTimePeriodExpired
     ///
@@ -402,8 +595,18 @@ namespace DiagnosticScheduling
     {
     	// Compute Elapsed Time in Current Diagnostic Test Period
     	UINT32 elapsedTime = (*m_RuntimeData.m_CalcElapsedTime)( m_TimestampCurrent, m_TimeTestCycleStarted );
+    	
+    	UINT32 period      = m_RuntimeData.m_PeriodForAllDiagnosticsToCompleteInMS;
 	
-        return ( elapsedTime >= m_RuntimeData.m_PeriodForAllDiagnosticsToCompleteInMS );
+        BOOL   expired     = ( elapsedTime >= period );
+        
+        // Tests that are not complete get back the time they were paused, within bounds, before the cycle expires.
+        if ( expired )
+        {
+            expired = ( ( elapsedTime - period ) >= ComputePausedTimeAllowance() );
+        }
+        
+        return expired;
     } 
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -419,6 +622,71 @@ namespace DiagnosticScheduling
 	
     	return (elapsedTime >= m_RuntimeData.m_PeriodForOneDiagnosticIteration );
     } 
+
+    /////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: IsTestHeldByPause
+    ///
+    /// Returns TRUE when a test is paused and has pause time left this diagnostic
+    /// cycle.  A test that has used up its pause time is resumed.
+    ///      
+    /////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    BOOL DiagnosticScheduler<T>::IsTestHeldByPause(T * & rpPbdt) 
+    {
+        if ( !rpPbdt->IsTestPaused() )
+        {
+            return FALSE;
+        }
+        
+    	UINT32 timePaused = ComputeTimePaused( rpPbdt, m_TimestampCurrent );
+	
+    	if ( timePaused < m_RuntimeData.m_MaxTestPauseTimeMS )
+    	{
+    	    return TRUE;
+    	}
+    	
+    	rpPbdt->SetTimePausedThisDiagCycle( timePaused );
+    	
+    	rpPbdt->SetTestPaused( FALSE );
+	
+    	return FALSE;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: IsTestHeldByPrerequisites
+    ///
+    /// Returns TRUE when a test that is a prerequisite of the test indicated 
+    /// has not completed yet this diagnostic cycle.
+    ///      
+    /////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    BOOL DiagnosticScheduler<T>::IsTestHeldByPrerequisites(T * & rpPbdt) 
+    {
+        UINT32 prerequisites = rpPbdt->GetPrerequisiteTestTypes();
+        
+        if ( 0 == prerequisites )
+        {
+            return FALSE;
+        }
+        
+    	for ( UINT32 ui = 0; ui < m_NumberOfDiagTests; ++ui )
+    	{
+    	    UINT32 testTypeBit = ( 1 << m_ppRunTimeDiagnostics[ ui ]->GetTestType() );
+    	    
+    	    if ( 0 == ( prerequisites & testTypeBit ) )
+    	    {
+    	        continue;
+    	    }
+    	    
+            if ( !IsTestingCompleteForDiagCycle(m_ppRunTimeDiagnostics[ ui ]) )
+            {
+                return TRUE;
+            }
+    	}
+    	
+    	return FALSE;
+    }
+
     /////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnositcScheduler: IsTestingCompleteForDiagCycle
     ///
@@ -462,15 +730,98 @@ namespace DiagnosticScheduling
 
     	return timeToRun;
     }
-};
-
-
-
 
+    /////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnositcScheduler: RunTestIteration
+    ///
+    /// Run one iteration of a test and account for the result.
+    ///      
+    /////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void DiagnosticScheduler<T>::RunTestIteration( T * & rpPbdt ) 
+    {
+    	UINT32	returnedErrorCode;
 
-	    		
+    	UINT64 timestampTestStarted = (*m_RuntimeData.m_SysTimestamp)();
 
+    	typename T::TestState testResult = rpPbdt->RunTest( returnedErrorCode );
+    	
+    	m_Statistics.m_TicksRunningTests += ( (*m_RuntimeData.m_SysTimestamp)() - timestampTestStarted );
 
+    	rpPbdt->SetCurrentTestState( testResult );
+    
+    	rpPbdt->SetIterationCompletedTimestamp( m_TimestampCurrent );
+		
+    	switch (testResult)
+    	{
+    	    case T::TEST_LOOP_COMPLETE: 
+    			{
+    			    if ( m_RuntimeData.m_MonitorIndividualTotalTestingTime ) 
+    			    {
+    			        UINT64  clk = rpPbdt->GetTestCompletedTimestamp();
+    		        
+                        UINT32 elapsedTime = (*m_RuntimeData.m_CalcElapsedTime)( m_TimestampCurrent, clk );
+                        
+                        UINT32 prevElapsedTime = rpPbdt->GetMaxTimeBetweenTestCompletions();
+                        
+                        if ( elapsedTime > prevElapsedTime )
+                        {
+                            rpPbdt->SetMaxTimeBetweenTestCompletions( elapsedTime );
+                        }
+                        
+                        rpPbdt->SetTestCompletedTimestamp( m_TimestampCurrent );
+                        
+    		        }      
+    			
+                    UINT32 numberOfTimesRan = rpPbdt->GetNumberOfTimesRanThisDiagCycle();
+	
+    	            ++numberOfTimesRan;
+	
+    	            rpPbdt->SetNumberOfTimesRanThisDiagCycle( numberOfTimesRan );
+    			}
+    				
+    			break;
+			
+    		case T::TEST_IN_PROGRESS:
+    			
+    		    if ( m_RuntimeData.m_MonitorIndividualTestIterationTimes )
+    			{
+    			    UINT64 clk = rpPbdt->GetTestStartTime();
+    			        
+    			    UINT32 elapsedTime = (*m_RuntimeData.m_CalcElapsedTime)( m_TimestampCurrent, clk );
+    			    
+    			    UINT32 timePaused  = ComputeTimePaused( rpPbdt, m_TimestampCurrent );
+    			    
+    			    UINT32 timePausedAtStart = rpPbdt->GetTimePausedAtTestStart();
+    			    
+    			    // Only the time paused since the test started is not held against it.  Tests complete before the
+    			    // pause time is reset for the next diagnostic cycle, the check is for safety.
+    			    timePaused  = ( timePaused > timePausedAtStart ) ? ( timePaused - timePausedAtStart ) : 0;
+    			    
+    			    elapsedTime = ( elapsedTime > timePaused ) ? ( elapsedTime - timePaused ) : 0;
+    			        
+    			    rpPbdt->SetCurrentIterationDuration( elapsedTime );
+    			}
+	
+    			break;
 
+    		default:
+    			
+    			ConfigureErrorCode( returnedErrorCode, rpPbdt->GetTestType() );
+		
+    			(*m_RuntimeData.m_ExceptionError)( returnedErrorCode );
+			
+    			break;
+    	}
+    }
+};
 
+#if defined(BLACKFIN_DIAG_HOST_BUILD)
+//
+// The Linux host build compiles this file on its own, so the scheduler is instantiated here for the diagnostic test 
+// type the host driver schedules.
+//
+#include "DiagnosticTesting.hpp"
 
+template class DiagnosticScheduling::DiagnosticScheduler<DiagnosticTesting::DiagnosticTest>;
+#endif // defined(BLACKFIN_DIAG_HOST_BUILD)
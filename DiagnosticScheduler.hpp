@@ -86,6 +86,21 @@ namespace DiagnosticScheduling
         // Error number for reporting when all tests are taking too long to complete.
         UINT32                                                  m_AllDiagnosticsNotCompletedErr;
 
+        // Longest time in milleseconds a test can be paused during a diagnostic cycle.  Paused time up to this amount
+        // is excluded from the test's deadline accounting.  A test paused for longer is resumed by the scheduler.
+        UINT32                                                  m_MaxTestPauseTimeMS;
+
+        // Returns TRUE when no other task has run since the previous call.  The scheduler keeps running iterations of
+        // a test back to back while this stays TRUE.
+        BOOL                                                    (*m_IsSystemIdle)();
+
+        // Most timer ticks spent running one batch of back to back iterations of a test when the system is idle.
+        UINT32                                                  m_IdleBatchTickBudget;
+
+        // TRUE to start the next diagnostic cycle as soon as all tests complete rather than when the time period for 
+        // all diagnostics to complete expires.  Each cycle still has to complete within that time period.
+        BOOL                                                    m_StartNextCycleWhenComplete;
+
     } 
     DiagnosticRunTimeParameters;
     
@@ -116,9 +131,30 @@ namespace DiagnosticScheduling
     {
         public:
 
-            //***************************************************************************
-            // PUBLIC METHODS
-            //***************************************************************************
+            typedef enum 
+        	{
+        		MAX_PERIOD_EXPIRED_ALL_TESTS_COMPLETE,
+        		MAX_PERIOD_EXPIRED_INCOMPLETE_TESTING,
+        		NO_NEW_SCHEDULING_PERIOD,
+        		NO_TESTS_TO_RUN_ALL_COMPLETED,
+        		NO_TEST_ITERATIONS_SCHEDULED,
+        		TEST_ITERATIONS_SCHEDULED,
+        		ALL_TESTS_COMPLETE_NEXT_CYCLE_STARTED,
+        		NUMBER_OF_SCHEDULER_STATES
+        	} 
+        	SchedulerStates;
+	
+            // Measurements of where the time in RunScheduled goes.  Times are in timer ticks.
+            typedef struct
+            {
+                UINT64                  m_TicksInRunScheduled;                              // Total time in RunScheduled
+                UINT64                  m_TicksDeterminingState;                            // Time determining the state
+                UINT64                  m_TicksRunningTests;                                // Time in the tests' RunTest
+                UINT32                  m_NumberOfRunScheduledCalls;                        // Calls since last reset
+                UINT32                  m_NumberOfCallsEndingInState[ NUMBER_OF_SCHEDULER_STATES ]; // Calls per state
+            }
+            SchedulerStatistics;
+
             
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnositcScheduler: DiagnosticScheduler
@@ -173,22 +209,71 @@ namespace DiagnosticScheduling
             //////////////////////////////////////////////////////////////////////////////////////////////////////// 
         	void RunScheduled();
 
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: PauseTest
+            ///
+            /// @par Full Description
+            ///      Pause the tests of the test type indicated.  Paused tests are not run and the time they spend 
+            ///      paused, up to m_MaxTestPauseTimeMS per diagnostic cycle, does not count against the time all
+            ///      diagnostics have to complete in.  Meant for suspending costly tests while the application is
+            ///      doing heavy foreground work like programming flash.
+            ///      
+            ///
+            /// @param testType                     Test type of the tests to pause.              
+            ///                               
+            /// @return                             TRUE when a test of the test type was found.
+            ///
+            //////////////////////////////////////////////////////////////////////////////////////////////////////// 
+        	BOOL PauseTest( UINT32 testType );
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: ResumeTest
+            ///
+            /// @par Full Description
+            ///      Resume the tests of the test type indicated that were paused by PauseTest.
+            ///      
+            ///
+            /// @param testType                     Test type of the tests to resume.              
+            ///                               
+            /// @return                             TRUE when a test of the test type was found.
+            ///
+            //////////////////////////////////////////////////////////////////////////////////////////////////////// 
+        	BOOL ResumeTest( UINT32 testType );
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: GetSchedulerStatistics
+            ///
+            /// @par Full Description
+            ///      Get the measurements of the time spent in the scheduler.  The time spent in scheduler bookkeeping 
+            ///      is m_TicksInRunScheduled less m_TicksRunningTests.
+            ///      
+            ///
+            /// @param rStatistics                  Reference to where the statistics are copied to.              
+            ///                               
+            /// @return                             Scheduler statistics since the last reset.
+            ///
+            //////////////////////////////////////////////////////////////////////////////////////////////////////// 
+        	void GetSchedulerStatistics( SchedulerStatistics & rStatistics );
+
+            ////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: ResetSchedulerStatistics
+            ///
+            /// @par Full Description
+            ///      Clear the measurements of the time spent in the scheduler.
+            ///      
+            ///
+            /// @param                              None.              
+            ///                               
+            /// @return                             Scheduler statistics cleared.
+            ///
+            //////////////////////////////////////////////////////////////////////////////////////////////////////// 
+        	void ResetSchedulerStatistics();
+
 
         private:
 
             static const UINT64  DEFAULT_INITIAL_TIMESTAMP = 0;	
 
-            typedef enum 
-        	{
-        		MAX_PERIOD_EXPIRED_ALL_TESTS_COMPLETE,
-        		MAX_PERIOD_EXPIRED_INCOMPLETE_TESTING,
-        		NO_NEW_SCHEDULING_PERIOD,
-        		NO_TESTS_TO_RUN_ALL_COMPLETED,
-        		NO_TEST_ITERATIONS_SCHEDULED,
-        		TEST_ITERATIONS_SCHEDULED,
-        	} 
-        	SchedulerStates;
-	
         	// Current statue the scheduler is in.
         	SchedulerStates                 m_CurrentSchedulerState;
 	
@@ -220,6 +305,10 @@ namespace DiagnosticScheduling
             UINT64 m_TimeLastIterationPeriodExpired;
 
             UINT32 m_NumberOfDiagCycles;
+            
+            // Measurements of the time spent in the scheduler.
+            SchedulerStatistics m_Statistics;
+            
             //***************************************************************************
             // PRIVATE METHODS
             //***************************************************************************
@@ -247,6 +336,38 @@ namespace DiagnosticScheduling
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             BOOL AreAllTestsComplete();
             
+            //////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: ComputePausedTimeAllowance
+            ///
+            /// @par Full Description
+            ///      Compute the time the diagnostic cycle is extended by because tests that have not completed yet 
+            ///      were paused.  It is the longest bounded time paused of the incomplete tests.
+            ///      
+            ///
+            /// @param                        None
+            ///
+            /// @return                       Extension to the diagnostic cycle in milleseconds
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32 ComputePausedTimeAllowance();
+            
+            //////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: ComputeTimePaused
+            ///
+            /// @par Full Description
+            ///      Compute the time a test has been paused this diagnostic cycle including any pause in progress, 
+            ///      bounded by m_MaxTestPauseTimeMS.
+            ///      
+            ///
+            /// @param                        rpPbdt:    Reference to a pointer to the test.
+            ///
+            ///                               timestamp: Current time in timer ticks.
+            ///
+            /// @return                       Milleseconds the test has been paused this diagnostic cycle
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32 ComputeTimePaused( T * & rpPbdt, UINT64 timestamp );
+            
             //////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnositcScheduler: ConfigureErrorCode
             ///
@@ -312,6 +433,28 @@ namespace DiagnosticScheduling
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
         	void DoMoreDiagnosticTesting();
 
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: IsAnotherBatchIterationAllowed
+            ///
+            /// @par Full Description
+            ///      Returns TRUE when another iteration of a test can be run in the current scheduling period.  The 
+            ///      test must still be in progress, under its maximum iterations per batch, the system must have 
+            ///      stayed idle, and the batch must be within m_IdleBatchTickBudget.
+            ///      
+            ///
+            /// @param                        rpPbdt:              Reference to a pointer to the test.
+            ///
+            ///                               iterationsRan:       Iterations run so far in the batch.
+            ///
+            ///                               batchStartTimestamp: Timestamp the batch started at.
+            ///                               
+            /// @return                       TRUE when another iteration of the test is to be run.
+            ///                             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsAnotherBatchIterationAllowed( T * &  rpPbdt, 
+                                                 UINT32 iterationsRan,
+                                                 UINT64 batchStartTimestamp );
+
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnositcScheduler: IsDiagnosticCyleTimePeriodExpired
             ///
@@ -340,6 +483,37 @@ namespace DiagnosticScheduling
             ///                             
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             BOOL IsIterationWithinDiagnosticCycleExpired();
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: IsTestHeldByPause
+            ///
+            /// @par Full Description
+            ///      Returns TRUE when a test is paused and has not used up the maximum pause time for the diagnostic
+            ///      cycle.  A test that has used it up is resumed.
+            ///      
+            ///
+            /// @param                        rpPbdt: Reference to a pointer to the test.
+            ///                               
+            /// @return                       TRUE when the test must not be run because it is paused.
+            ///                             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsTestHeldByPause( T * & rpPbdt );
+
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: IsTestHeldByPrerequisites
+            ///
+            /// @par Full Description
+            ///      Returns TRUE when a test the test depends on has not completed in the current diagnostic cycle.
+            ///      Prerequisites that are not in the array of tests being run do not hold the test.
+            ///      
+            ///
+            /// @param                        rpPbdt: Reference to a pointer to the test.
+            ///                               
+            /// @return                       TRUE when the test must not be run until its prerequisites complete.
+            ///                             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            BOOL IsTestHeldByPrerequisites( T * & rpPbdt );
+
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnositcScheduler: IsTestingCompleteForDiagCycle
             ///
@@ -374,6 +548,20 @@ namespace DiagnosticScheduling
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
         	BOOL IsTestScheduledToRun( T * & rpPbdt );
 
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnositcScheduler: RunTestIteration
+            ///
+            /// @par Full Description
+            ///      Run one iteration of a test, record the result, and report any error the test detected.
+            ///      
+            ///
+            /// @param                         rpPbdt: Reference to a pointer to the test to run.
+            ///                               
+            /// @return                        Current test state of the test configured with the iteration result.
+            ///                             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+        	void RunTestIteration( T * & rpPbdt );
+
     };
 };
 #endif  // if !defined(DIAGNOSTIC_SCHEDULER_HPP)
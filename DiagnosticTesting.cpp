@@ -110,6 +110,17 @@ namespace DiagnosticTesting
 	    return m_TestExecutionData.m_IterationPeriod;
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: GetMaxIterationsPerBatch
+    ///
+    ///       Get the most iterations of the test that can be run back to back when the system is idle
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 DiagnosticTest::GetMaxIterationsPerBatch()
+    {
+        return m_TestExecutionData.m_MaxIterationsPerBatch;
+    }
+    
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnosticTest: GetMaxTimeBetweenTestCompletions
     ///
@@ -165,6 +176,50 @@ namespace DiagnosticTesting
         return m_TestExecutionData.m_TestStartTimestamp;
     }
      
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: GetPauseStartTimestamp
+    ///
+    ///       Get the timestamp of when the application last paused the test
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT64 DiagnosticTest::GetPauseStartTimestamp()
+    {
+        return m_TestExecutionData.m_PauseStartTimestamp;
+    }
+     
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: GetPrerequisiteTestTypes
+    ///
+    ///       Get the bit mask of test types that must complete before this test can run
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 DiagnosticTest::GetPrerequisiteTestTypes()
+    {
+        return m_TestExecutionData.m_PrerequisiteTestTypes;
+    }
+     
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: GetTimePausedThisDiagCycle
+    ///
+    ///       Get the time in milleseconds the test has been paused during the current diagnostic cycle
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 DiagnosticTest::GetTimePausedThisDiagCycle()
+    {
+        return m_TestExecutionData.m_TimePausedThisDiagCycle;
+    }
+     
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: GetTimePausedAtTestStart
+    ///
+    ///       Get the time in milleseconds the test had been paused during the diagnostic cycle when it started
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    UINT32 DiagnosticTest::GetTimePausedAtTestStart()
+    {
+        return m_TestExecutionData.m_TimePausedAtTestStart;
+    }
+     
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnosticTest: GetTestType
     ///
@@ -176,6 +231,17 @@ namespace DiagnosticTesting
 	   return m_TestExecutionData.m_TestType; 
     }
 	
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: IsTestPaused
+    ///
+    ///       Returns TRUE while the application has the test paused
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    BOOL DiagnosticTest::IsTestPaused()
+    {
+        return m_TestExecutionData.m_TestPaused;
+    }
+	
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnosticTest: SetCurrentIterationDuration
     ///
@@ -221,6 +287,17 @@ namespace DiagnosticTesting
 	    m_TestExecutionData.m_IterationPeriod = period;
     }
 			
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: SetPauseStartTimestamp
+    ///
+    ///        Set the timestamp of when the application paused the test
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void DiagnosticTest::SetPauseStartTimestamp( UINT64 timestamp )
+    {
+        m_TestExecutionData.m_PauseStartTimestamp = timestamp;
+    }
+			
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///	METHOD NAME: DiagnosticTest: SetMaxTimeBetweenTestCompletions
     ///
@@ -265,6 +342,39 @@ namespace DiagnosticTesting
         m_TestExecutionData.m_TestStartTimestamp = time;
     }
      
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: SetTestPaused
+    ///
+    ///        Set whether or not the test is paused
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void DiagnosticTest::SetTestPaused( BOOL paused )
+    {
+        m_TestExecutionData.m_TestPaused = paused;
+    }
+     
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: SetTimePausedThisDiagCycle
+    ///
+    ///        Set the time in milleseconds the test has been paused during the current diagnostic cycle
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void DiagnosticTest::SetTimePausedThisDiagCycle( UINT32 timePaused )
+    {
+        m_TestExecutionData.m_TimePausedThisDiagCycle = timePaused;
+    }
+     
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///	METHOD NAME: DiagnosticTest: SetTimePausedAtTestStart
+    ///
+    ///        Set the time in milleseconds the test had been paused during the diagnostic cycle when it started
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+    void DiagnosticTest::SetTimePausedAtTestStart( UINT32 timePaused )
+    {
+        m_TestExecutionData.m_TimePausedAtTestStart = timePaused;
+    }
+     
     //***************************************************************************
     // PROTECTED METHODS
     //***************************************************************************
@@ -282,8 +392,8 @@ namespace DiagnosticTesting
 		     || (DiagnosticTest::TEST_IDLE == m_TestExecutionData.m_CurrentTestState)
 		   ) 
 	    {
-			m_TestExecutionData.m_NmbrTimesRanThisDiagCycle = 0;
-
+			// The scheduler clears the number of times ran at the start of each diagnostic cycle, a test run more
+			// than once per cycle starts over here without losing count.
 		    btd->ConfigureForNextTestCycle();
 	    }
     }
@@ -68,7 +68,11 @@ namespace DiagnosticTesting
 		        DIAG_SCHEDULER_TEST_TYPE      = 4,
 		        DIAG_TIMER_TEST_TYPE          = 5,
 		        DIAG_INSTRUCTIONS_TEST_TYPE   = 6,
-		        DIAG_NO_TEST_TYPE             = 7
+		        DIAG_READ_ONLY_DATA_TEST_TYPE = 7,
+		        DIAG_CRITICAL_DATA_RAM_TEST_TYPE = 8,
+		        DIAG_SDRAM_TEST_TYPE          = 9,
+		        DIAG_UNUSED_STACK_TEST_TYPE   = 10,
+		        DIAG_NO_TEST_TYPE             = 11
 	        } 
 	        DiagnosticTestTypes;
 	
@@ -85,6 +89,12 @@ namespace DiagnosticTesting
    		        UINT32		               			         m_NmbrTimesRanThisDiagCycle;   		// Times test has run this cycle
 		        DiagnosticTestTypes 				         m_TestType;
                 TestState                                    m_CurrentTestState;	
+                BOOL                                         m_TestPaused;                      // TRUE while the application has paused the test
+                UINT64                                       m_PauseStartTimestamp;             // When the current pause started
+                UINT32                                       m_TimePausedThisDiagCycle;         // Milleseconds paused this cycle
+                UINT32                                       m_TimePausedAtTestStart;           // Milleseconds paused this cycle when test started
+                UINT32                                       m_MaxIterationsPerBatch;           // Iterations run back to back when idle
+                UINT32                                       m_PrerequisiteTestTypes;           // Bit per test type that must complete first
             } 
             ExecuteTestData;    
 
@@ -137,6 +147,21 @@ namespace DiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 	        UINT32                                           GetIterationPeriod();
 	        
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: GetMaxIterationsPerBatch
+            ///
+            /// @par Full Description
+            ///      Get the most iterations of the test the scheduler may run back to back in one scheduling period 
+            ///      when the system is idle.  Tests that must run exactly once per iteration period use 1.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           Maximum number of iterations run in one batch.
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        UINT32                                           GetMaxIterationsPerBatch();
+	        
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnosticTest: GetMaxTimeBetweenTestCompletions
             ///
@@ -207,6 +232,65 @@ namespace DiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             UINT64                                           GetTestStartTime();
             	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: GetPauseStartTimestamp
+            ///
+            /// @par Full Description
+            ///      Get the timestamp of when the application last paused the test.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           The timestamp of when the current pause started
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT64                                           GetPauseStartTimestamp();
+            	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: GetPrerequisiteTestTypes
+            ///
+            /// @par Full Description
+            ///      Get the test types that must complete in the current diagnostic cycle before this test can run.
+            ///      Bit ( 1 << test type ) is set for each prerequisite test type.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           Bit mask of prerequisite test types
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32                                           GetPrerequisiteTestTypes();
+            	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: GetTimePausedThisDiagCycle
+            ///
+            /// @par Full Description
+            ///      Get the time in milleseconds the test has been paused during the current diagnostic cycle.  Pauses
+            ///      still in progress are not included.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           Milleseconds paused this diagnostic cycle
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32                                           GetTimePausedThisDiagCycle();
+            	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: GetTimePausedAtTestStart
+            ///
+            /// @par Full Description
+            ///      Get the time in milleseconds the test had been paused during the diagnostic cycle when the test 
+            ///      started its first iteration.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           Milleseconds paused this diagnostic cycle when the test started
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            UINT32                                           GetTimePausedAtTestStart();
+            	
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnosticTest: GetTestType
             ///
@@ -221,6 +305,20 @@ namespace DiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
 	        DiagnosticTestTypes                              GetTestType();
 	        
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: IsTestPaused
+            ///
+            /// @par Full Description
+            ///      Returns TRUE while the application has the test paused.
+            ///      
+            ///
+            /// @param                            None
+            ///                               
+            /// @return                           TRUE when the test is paused
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+	        BOOL                                             IsTestPaused();
+	        
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnosticTest: SetCurrentIterationDuration
             ///
@@ -279,6 +377,20 @@ namespace DiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             void			                                 SetIterationPeriod( UINT32 period );
 	
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: SetPauseStartTimestamp
+            ///
+            /// @par Full Description
+            ///      Set the timestamp of when the application paused the test.
+            ///      
+            ///
+            /// @param                            The timestamp of when the pause started
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void			                                 SetPauseStartTimestamp( UINT64 timestamp );
+	
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnosticTest: SetMaxTimeBetweenTestCompletions
             ///
@@ -335,6 +447,49 @@ namespace DiagnosticTesting
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             void                                             SetTestStartTime( UINT64 time);
             
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: SetTestPaused
+            ///
+            /// @par Full Description
+            ///      Set whether or not the test is paused.
+            ///      
+            ///
+            /// @param                            TRUE to pause the test, FALSE to resume it
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void                                             SetTestPaused( BOOL paused );
+            
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: SetTimePausedThisDiagCycle
+            ///
+            /// @par Full Description
+            ///      Set the time in milleseconds the test has been paused during the current diagnostic cycle.
+            ///      
+            ///
+            /// @param                            Milleseconds paused this diagnostic cycle
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void                                             SetTimePausedThisDiagCycle( UINT32 timePaused );
+            
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ///	METHOD NAME: DiagnosticTest: SetTimePausedAtTestStart
+            ///
+            /// @par Full Description
+            ///      Set the time in milleseconds the test had been paused during the diagnostic cycle when the test 
+            ///      started its first iteration.
+            ///      
+            ///
+            /// @param                            Milleseconds paused this diagnostic cycle when the test started
+            ///                               
+            /// @return                           None
+            ///
+            ///////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void                                             SetTimePausedAtTestStart( UINT32 timePaused );
+            
             ///////////////////////////////////////////////////////////////////////////////////////////////////////////
             ///	METHOD NAME: DiagnosticTest: RunTest
             ///
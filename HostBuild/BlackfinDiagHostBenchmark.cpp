@@ -0,0 +1,555 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagHostBenchmark.cpp
+///
+/// Linux host driver of the diagnostics benchmarks.
+///
+/// Runs BlackfinDiagDataRamBenchmark for each data RAM test mode over a simulated 32K byte bank, then compares the
+/// runtime configured test with BlackfinDiagDataRamSpecialised and times the byte and word kernels on their own, and
+/// prints the results.  The throughput and cycles are those of the C++ reference kernels on the host, not of the
+/// assembly language on Blackfin, so they compare one configuration with another and say nothing of the time on the
+/// target.
+///
+/// Then runs BlackfinDiagInstructionCompareBenchmark for buffers from 256 bytes, the smallest compared, up to the
+/// largest, each starting on a word boundary and a byte past one, and prints the byte and word compare results.  The
+/// compare kernels are the same C++ on the host as on the target, built by a different compiler.
+///
+/// Last runs DiagnosticScheduling::DiagnosticScheduler over a few host tests that each do a fixed amount of work per
+/// iteration, calling RunScheduled in a loop as the background task does, and prints the scheduler statistics.  The
+/// timestamps are nanoseconds of the host's monotonic clock, so the time the scheduler spends on its bookkeeping can be
+/// set against the time spent in the tests.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+#include <stdio.h>
+#include <time.h>
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+
+
+// C++ PROJECT INCLUDES
+#include "BlackfinDiagDataRamBenchmark.hpp"
+#include "BlackfinDiagInstructionCompareBenchmark.hpp"
+#include "DiagnosticScheduler.hpp"
+#include "DiagnosticTesting.hpp"
+
+
+// FORWARD REFERENCES
+
+using namespace BlackfinDiagnosticTesting;
+
+// Fault free passes, and faults injected of each model, per test mode.
+static const UINT32 HOST_BENCHMARK_TRIALS          = 20;
+static const UINT32 HOST_BENCHMARK_SEED            = 1234;
+static const UINT32 HOST_BENCHMARK_BYTES_PER_ITERATION = 0x400;
+static const UINT32 HOST_BENCHMARK_KERNEL_PASSES   = 20;
+
+// Patterns of the runtime configured test, as BlackfinDiagRuntime.cpp configures banks A and B.
+static const UINT32 HOST_BENCHMARK_TEST_PATTERNS[] =
+                                            {
+                                                0xffffffff, 0xaaaaaaaa, 0x55555555, 0,
+                                                0xcccccccc, 0x33333333, 0xf0f0f0f0, 0x0f0f0f0f
+                                            };
+
+// Test modes benchmarked and their names, in the order printed.
+static const BlackfinDiagDataRam::DataRamTestModes HOST_BENCHMARK_MODES[] =
+                                            {
+                                                BlackfinDiagDataRam::DATA_RAM_PATTERN_TEST,
+                                                BlackfinDiagDataRam::DATA_RAM_GENERATED_PATTERN_TEST,
+                                                BlackfinDiagDataRam::DATA_RAM_MARCH_C_MINUS,
+                                                BlackfinDiagDataRam::DATA_RAM_MARCH_B,
+                                                BlackfinDiagDataRam::DATA_RAM_MATS_PLUS,
+                                                BlackfinDiagDataRam::DATA_RAM_SAVE_RESTORE_BLOCK_TEST,
+                                                BlackfinDiagDataRam::DATA_RAM_MDMA_SAVE_RESTORE_BLOCK_TEST
+                                            };
+
+static const char * const HOST_BENCHMARK_MODE_NAMES[] =
+                                            {
+                                                "pattern",
+                                                "generated",
+                                                "march C-",
+                                                "march B",
+                                                "MATS+",
+                                                "block",
+                                                "MDMA block"
+                                            };
+
+static const UINT32 HOST_BENCHMARK_NMBR_MODES = sizeof( HOST_BENCHMARK_MODES ) / sizeof( HOST_BENCHMARK_MODES[ 0 ] );
+
+// Sizes of the instruction RAM compare buffers, in bytes, and the bytes past a word boundary they start.
+static const UINT32 HOST_BENCHMARK_COMPARE_SIZES[]   = { 0x100, 0x400, 0x1000, COMPARE_BENCHMARK_MAX_BYTES };
+
+static const UINT32 HOST_BENCHMARK_COMPARE_OFFSETS[] = { 0, 1 };
+
+// Bytes compared per size and offset, the passes are this over the size.
+static const UINT32 HOST_BENCHMARK_COMPARE_BYTES     = 0x1000000;
+
+// Scheduler run, its periods in milleseconds and its timestamps in nanoseconds.
+static const UINT32 HOST_SCHEDULER_RUN_MS                = 250;
+static const UINT32 HOST_SCHEDULER_PERIOD_ALL_TESTS_MS   = 1000;
+static const UINT32 HOST_SCHEDULER_PERIOD_ITERATION_MS   = 1;
+static const UINT32 HOST_SCHEDULER_IDLE_BATCH_TICKS      = 100000;
+static const UINT32 HOST_SCHEDULER_MAX_ITERATIONS_BATCH  = 4;
+static const UINT64 HOST_SCHEDULER_NS_PER_SECOND         = 1000000000;
+static const UINT64 HOST_SCHEDULER_NS_PER_MS             = 1000000;
+
+// Error numbers the scheduler reports its own errors with.
+static const UINT32 HOST_SCHEDULER_CORRUPTED_VECTOR_ERR  = 1;
+static const UINT32 HOST_SCHEDULER_CORRUPTED_MEMORY_ERR  = 2;
+static const UINT32 HOST_SCHEDULER_TEST_TOO_LONG_ERR     = 3;
+static const UINT32 HOST_SCHEDULER_NOT_COMPLETED_ERR     = 4;
+
+// Words the host tests work over each iteration.
+static const UINT32 HOST_SCHEDULER_TEST_WORDS            = 0x400;
+
+static const char * const HOST_SCHEDULER_STATE_NAMES[] =
+                                            {
+                                                "period expired, all complete",
+                                                "period expired, incomplete",
+                                                "no new scheduling period",
+                                                "no tests to run, all complete",
+                                                "no test iterations scheduled",
+                                                "test iterations scheduled",
+                                                "all complete, next cycle started"
+                                            };
+
+// Errors the scheduler reported.
+static UINT32 s_NmbrSchedulerErrors;
+
+// Simulated RAM, too big for the stack.
+static BlackfinDiagRamSimulator s_Simulator;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: PrintDataRamResults
+///
+///      Prints the results of benchmarking a data RAM test mode
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintDataRamResults( const char * pName, const BlackfinDiagDataRamBenchmark::BenchmarkResults & rResults )
+{
+    printf( "%-12s %10llu B/s %4u.%02u cycles/B  false errors %u  corruptions %u  detected %%",
+            pName,
+            static_cast<unsigned long long>( rResults.m_BytesPerSecond ),
+            rResults.m_HundredthsOfCyclesPerByte / BENCHMARK_HUNDREDTHS,
+            rResults.m_HundredthsOfCyclesPerByte % BENCHMARK_HUNDREDTHS,
+            rResults.m_NmbrFalseErrors,
+            rResults.m_NmbrLiveDataCorruptions );
+
+    for ( UINT32 model = 0; model < BlackfinDiagRamSimulator::NUMBER_OF_RAM_FAULT_MODELS; ++model )
+    {
+        printf( " %3u", rResults.m_DetectionRatePercent[ model ] );
+    }
+
+    printf( "\n" );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: PrintKernelResults
+///
+///      Prints the results of timing a kernel
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintKernelResults( const char * pName, const BlackfinDiagDataRamBenchmark::KernelResults & rResults )
+{
+    UINT32 hundredthsPerPattern = ( rResults.m_NmbrTestPatterns > 0 ) 
+                                  ? ( rResults.m_HundredthsOfCyclesPerByte / rResults.m_NmbrTestPatterns ) : 0;
+
+    printf( "%-12s %10llu B/s %4u.%02u cycles/B  %2u patterns  %u.%02u cycles/B/pattern  false errors %u\n",
+            pName,
+            static_cast<unsigned long long>( rResults.m_BytesPerSecond ),
+            rResults.m_HundredthsOfCyclesPerByte / BENCHMARK_HUNDREDTHS,
+            rResults.m_HundredthsOfCyclesPerByte % BENCHMARK_HUNDREDTHS,
+            rResults.m_NmbrTestPatterns,
+            hundredthsPerPattern / BENCHMARK_HUNDREDTHS,
+            hundredthsPerPattern % BENCHMARK_HUNDREDTHS,
+            rResults.m_NmbrFalseErrors );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: PrintRatio
+///
+///      Prints how many times faster one result is than another, to two places
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintRatio( const char * pName, UINT64 faster, UINT64 slower )
+{
+    UINT64 hundredths = ( slower > 0 ) ? ( ( faster * BENCHMARK_HUNDREDTHS ) / slower ) : 0;
+
+    printf( "%s %llu.%02llu\n",
+            pName,
+            static_cast<unsigned long long>( hundredths / BENCHMARK_HUNDREDTHS ),
+            static_cast<unsigned long long>( hundredths % BENCHMARK_HUNDREDTHS ) );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: RunDataRamBenchmark
+///
+///      Benchmarks each data RAM test mode and compares the runtime configured and specialised tests
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void RunDataRamBenchmark()
+{
+    BlackfinDiagDataRamBenchmark benchmark( s_Simulator,
+                                            HOST_BENCHMARK_TEST_PATTERNS,
+                                            sizeof( HOST_BENCHMARK_TEST_PATTERNS ) / sizeof( UINT32 ),
+                                            HOST_BENCHMARK_BYTES_PER_ITERATION );
+
+    printf( "Data RAM test modes, detected %% of stuck-at, transition, coupling and address faults\n" );
+
+    for ( UINT32 ui = 0; ui < HOST_BENCHMARK_NMBR_MODES; ++ui )
+    {
+        BlackfinDiagDataRamBenchmark::BenchmarkResults results;
+
+        benchmark.Run( HOST_BENCHMARK_MODES[ ui ], HOST_BENCHMARK_TRIALS, HOST_BENCHMARK_SEED, results );
+
+        PrintDataRamResults( HOST_BENCHMARK_MODE_NAMES[ ui ], results );
+    }
+
+    printf( "\nRuntime configured and specialised data RAM tests\n" );
+
+    for ( UINT32 ui = 0; ui < HOST_BENCHMARK_NMBR_MODES; ++ui )
+    {
+        BlackfinDiagDataRamBenchmark::VariantComparison comparison;
+
+        benchmark.CompareVariants( HOST_BENCHMARK_MODES[ ui ], HOST_BENCHMARK_TRIALS, HOST_BENCHMARK_SEED, comparison );
+
+        printf( "%s\n", HOST_BENCHMARK_MODE_NAMES[ ui ] );
+
+        PrintDataRamResults( "  runtime", comparison.m_RuntimeConfigured );
+
+        PrintDataRamResults( "  specialised", comparison.m_Specialised );
+    }
+
+    printf( "\nTable and generated pattern kernels, the same %u patterns\n", NMBR_GENERATED_PATTERNS );
+
+    BlackfinDiagDataRamBenchmark::PatternKernelComparison patternKernels;
+
+    benchmark.ComparePatternKernels( HOST_BENCHMARK_KERNEL_PASSES, HOST_BENCHMARK_SEED, patternKernels );
+
+    PrintKernelResults( "table", patternKernels.m_TablePatterns );
+
+    PrintKernelResults( "generated", patternKernels.m_GeneratedPatterns );
+
+    PrintRatio( "generated / table bytes per second", 
+                patternKernels.m_GeneratedPatterns.m_BytesPerSecond, 
+                patternKernels.m_TablePatterns.m_BytesPerSecond );
+
+    printf( "\nByte and word kernels, the runtime configured patterns\n" );
+
+    BlackfinDiagDataRamBenchmark::ByteKernelComparison byteKernels;
+
+    benchmark.CompareByteAndWordKernels( HOST_BENCHMARK_KERNEL_PASSES, HOST_BENCHMARK_SEED, byteKernels );
+
+    PrintKernelResults( "bytes", byteKernels.m_Bytes );
+
+    PrintKernelResults( "words", byteKernels.m_Words );
+
+    PrintRatio( "words / bytes bytes per second", 
+                byteKernels.m_Words.m_BytesPerSecond, 
+                byteKernels.m_Bytes.m_BytesPerSecond );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: PrintCompareResults
+///
+///      Prints the results of benchmarking an instruction RAM compare kernel
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void PrintCompareResults( const char * pName, const BlackfinDiagInstructionCompareBenchmark::CompareResults & rResults )
+{
+    printf( "  %-6s %10llu B/s %4u.%02u cycles/B  false errors %u  mismatches detected %u of %u\n",
+            pName,
+            static_cast<unsigned long long>( rResults.m_BytesPerSecond ),
+            rResults.m_HundredthsOfCyclesPerByte / COMPARE_BENCHMARK_HUNDREDTHS,
+            rResults.m_HundredthsOfCyclesPerByte % COMPARE_BENCHMARK_HUNDREDTHS,
+            rResults.m_NmbrFalseErrors,
+            rResults.m_NmbrMismatchesDetected,
+            rResults.m_NmbrMismatchesInjected );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: RunInstructionCompareBenchmark
+///
+///      Benchmarks the byte and word instruction RAM compare kernels for each buffer size and offset
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void RunInstructionCompareBenchmark()
+{
+    BlackfinDiagInstructionCompareBenchmark benchmark;
+
+    printf( "\nInstruction RAM compare kernels\n" );
+
+    for ( UINT32 size = 0; size < ( sizeof( HOST_BENCHMARK_COMPARE_SIZES ) / sizeof( UINT32 ) ); ++size )
+    {
+        for ( UINT32 offset = 0; offset < ( sizeof( HOST_BENCHMARK_COMPARE_OFFSETS ) / sizeof( UINT32 ) ); ++offset )
+        {
+            UINT32 nmbrBytes  = HOST_BENCHMARK_COMPARE_SIZES[ size ];
+
+            UINT32 byteOffset = HOST_BENCHMARK_COMPARE_OFFSETS[ offset ];
+
+            BlackfinDiagInstructionCompareBenchmark::KernelComparison comparison;
+
+            if ( !benchmark.CompareKernels( nmbrBytes, 
+                                            byteOffset, 
+                                            HOST_BENCHMARK_COMPARE_BYTES / nmbrBytes, 
+                                            HOST_BENCHMARK_SEED, 
+                                            comparison ) )
+            {
+                continue;
+            }
+
+            printf( "%u bytes, %u past a word boundary\n", nmbrBytes, byteOffset );
+
+            PrintCompareResults( "bytes", comparison.m_Bytes );
+
+            PrintCompareResults( "words", comparison.m_Words );
+
+            PrintRatio( "  words / bytes bytes per second", 
+                        comparison.m_Words.m_BytesPerSecond, 
+                        comparison.m_Bytes.m_BytesPerSecond );
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// CLASS NAME: HostSchedulerTest
+///
+/// Test the host scheduler runs, each iteration sums the same words and the test completes after a number of 
+/// iterations.
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class HostSchedulerTest : public DiagnosticTesting::DiagnosticTest 
+{
+    public:
+
+        HostSchedulerTest( DiagnosticTesting::DiagnosticTest::ExecuteTestData & rTestData, UINT32 nmbrIterations ) 
+                            :  DiagnosticTesting::DiagnosticTest ( rTestData ),
+                               m_NmbrIterations                  ( nmbrIterations ),
+                               m_NmbrIterationsRan               ( 0 ),
+                               m_Sum                             ( 0 )
+        {
+        }
+
+        DiagnosticTesting::DiagnosticTest::TestState RunTest( UINT32 & /* rErrorCode */ )
+        {
+            ConfigForAnyNewDiagCycle( this );
+
+            for ( UINT32 ui = 0; ui < HOST_SCHEDULER_TEST_WORDS; ++ui )
+            {
+                m_Sum += m_Words[ ui ] + ui;
+            }
+
+            if ( ++m_NmbrIterationsRan < m_NmbrIterations )
+            {
+                return DiagnosticTesting::DiagnosticTest::TEST_IN_PROGRESS;
+            }
+
+            return DiagnosticTesting::DiagnosticTest::TEST_LOOP_COMPLETE;
+        }
+
+    protected:
+
+        void ConfigureForNextTestCycle()
+        {
+            m_NmbrIterationsRan = 0;
+        }
+
+    private:
+
+        HostSchedulerTest(const HostSchedulerTest &);
+
+        const HostSchedulerTest & operator = (const HostSchedulerTest & );
+
+        UINT32          m_NmbrIterations;
+
+        UINT32          m_NmbrIterationsRan;
+
+        volatile UINT32 m_Sum;
+
+        UINT32          m_Words[ HOST_SCHEDULER_TEST_WORDS ];
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: HostTimestamp
+///
+///      Timestamp of the host scheduler, nanoseconds of the monotonic clock
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static UINT64 HostTimestamp()
+{
+    struct timespec now;
+
+    clock_gettime( CLOCK_MONOTONIC, &now );
+
+    return ( static_cast<UINT64>( now.tv_sec ) * HOST_SCHEDULER_NS_PER_SECOND ) + static_cast<UINT64>( now.tv_nsec );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: HostElapsedTimeMS
+///
+///      Milleseconds between host scheduler timestamps
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static UINT32 HostElapsedTimeMS( UINT64 current, UINT64 previous )
+{
+    return static_cast<UINT32>( ( current - previous ) / HOST_SCHEDULER_NS_PER_MS );
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: HostSchedulerError
+///
+///      Counts the errors the host scheduler reports
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void HostSchedulerError( INT /* errorCode */ )
+{
+    ++s_NmbrSchedulerErrors;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: HostKickWatchdog
+///
+///      The host has no watchdog
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void HostKickWatchdog()
+{
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: HostIsSystemIdle
+///
+///      Nothing else runs on the host while the scheduler is benchmarked
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static BOOL HostIsSystemIdle()
+{
+    return TRUE;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: RunSchedulerBenchmark
+///
+///      Runs the scheduler over the host tests and prints its statistics
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+static void RunSchedulerBenchmark()
+{
+    typedef DiagnosticScheduling::DiagnosticScheduler<DiagnosticTesting::DiagnosticTest> HostSchedule;
+
+    DiagnosticTesting::DiagnosticTest::ExecuteTestData execTestData = 
+                                                            {
+                                                                HOST_SCHEDULER_PERIOD_ITERATION_MS,
+                                                                0,
+                                                                0,
+                                                                0,
+                                                                0,
+                                                                0,
+                                                                1,
+                                                                0,
+                                                                DiagnosticTesting::DiagnosticTest::DIAG_DATA_RAM_TEST_TYPE,
+                                                                DiagnosticTesting::DiagnosticTest::TEST_IDLE,
+                                                                FALSE,
+                                                                0,
+                                                                0,
+                                                                0,
+                                                                HOST_SCHEDULER_MAX_ITERATIONS_BATCH,
+                                                                0
+                                                            };
+
+    static HostSchedulerTest dataRamTest( execTestData, 16 );
+
+    execTestData.m_TestType = DiagnosticTesting::DiagnosticTest::DIAG_READ_ONLY_DATA_TEST_TYPE;
+
+    static HostSchedulerTest readOnlyDataTest( execTestData, 64 );
+
+    execTestData.m_TestType              = DiagnosticTesting::DiagnosticTest::DIAG_INSTRUCTIONS_TEST_TYPE;
+    execTestData.m_MaxIterationsPerBatch = 1;
+
+    static HostSchedulerTest instructionsTest( execTestData, 1 );
+
+    DiagnosticTesting::DiagnosticTest * pHostTests[] = { &dataRamTest, &readOnlyDataTest, &instructionsTest };
+
+    DiagnosticScheduling::DiagnosticRunTimeParameters drtp = 
+                                            {
+                                                &HostTimestamp,
+                                                &HostElapsedTimeMS,
+                                                &HostSchedulerError,
+                                                &HostKickWatchdog,
+                                                HOST_SCHEDULER_PERIOD_ALL_TESTS_MS,
+                                                HOST_SCHEDULER_PERIOD_ITERATION_MS,
+                                                FALSE,    // m_MonitorIndividualTotalTestingTime
+                                                FALSE,    // m_MonitorIndividualTestIterationTimes
+                                                DiagnosticTesting::DiagnosticTest::DIAG_SCHEDULER_TEST_TYPE,
+                                                HOST_SCHEDULER_CORRUPTED_VECTOR_ERR,
+                                                HOST_SCHEDULER_CORRUPTED_MEMORY_ERR,
+                                                HOST_SCHEDULER_TEST_TOO_LONG_ERR,
+                                                HOST_SCHEDULER_NOT_COMPLETED_ERR,
+                                                0,        // m_MaxTestPauseTimeMS
+                                                &HostIsSystemIdle,
+                                                HOST_SCHEDULER_IDLE_BATCH_TICKS,
+                                                TRUE      // m_StartNextCycleWhenComplete
+                                            };
+
+    static HostSchedule schedule( pHostTests, sizeof( pHostTests ) / sizeof( pHostTests[ 0 ] ), drtp );
+
+    UINT64 start = HostTimestamp();
+
+    while ( HostElapsedTimeMS( HostTimestamp(), start ) < HOST_SCHEDULER_RUN_MS )
+    {
+        schedule.RunScheduled();
+    }
+
+    HostSchedule::SchedulerStatistics statistics;
+
+    schedule.GetSchedulerStatistics( statistics );
+
+    UINT64 ticksBookkeeping = statistics.m_TicksInRunScheduled - statistics.m_TicksRunningTests;
+
+    UINT32 nmbrCalls        = ( statistics.m_NumberOfRunScheduledCalls > 0 ) ? statistics.m_NumberOfRunScheduledCalls : 1;
+
+    printf( "\nScheduler over %u ms, %u calls to RunScheduled, %u errors\n", 
+            HOST_SCHEDULER_RUN_MS, 
+            statistics.m_NumberOfRunScheduledCalls, 
+            s_NmbrSchedulerErrors );
+
+    printf( "  in RunScheduled        %12llu ns\n", static_cast<unsigned long long>( statistics.m_TicksInRunScheduled ) );
+    printf( "  determining state      %12llu ns\n", static_cast<unsigned long long>( statistics.m_TicksDeterminingState ) );
+    printf( "  running tests          %12llu ns\n", static_cast<unsigned long long>( statistics.m_TicksRunningTests ) );
+    printf( "  bookkeeping            %12llu ns, %llu ns per call\n", 
+            static_cast<unsigned long long>( ticksBookkeeping ),
+            static_cast<unsigned long long>( ticksBookkeeping / nmbrCalls ) );
+
+    PrintRatio( "  running tests / in RunScheduled", statistics.m_TicksRunningTests, statistics.m_TicksInRunScheduled );
+
+    for ( UINT32 state = 0; state < HostSchedule::NUMBER_OF_SCHEDULER_STATES; ++state )
+    {
+        printf( "  %-34s %u calls\n", HOST_SCHEDULER_STATE_NAMES[ state ], statistics.m_NumberOfCallsEndingInState[ state ] );
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: main
+///
+///      Runs the benchmarks
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    RunDataRamBenchmark();
+
+    RunInstructionCompareBenchmark();
+
+    RunSchedulerBenchmark();
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file BlackfinDiagHostSupport.cpp
+///
+/// What the Linux host build of the diagnostics needs from the OS and the product in place of the target's.
+///
+/// _OS_Assert returns instead of writing the crash header and resetting, so the benchmarks can count the errors the
+/// tests report.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// SYSTEM INCLUDES
+// (none)
+//
+// C PROJECT INCLUDES
+#include "Defs.h"
+#include "Os_iotk.h"
+
+
+// C++ PROJECT INCLUDES
+// (none)
+
+
+// FORWARD REFERENCES
+
+// User data _OS_Assert copies into the crash header on the target.
+extern "C" USER_CRASH_DATA user_crash_data;
+
+USER_CRASH_DATA user_crash_data;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+///	METHOD NAME: _OS_Assert
+///
+///      Returns, the error has been reported by the test and user_crash_data filled in
+///
+///////////////////////////////////////////////////////////////////////////////////////////////////////////
+extern "C" void _OS_Assert( INT /* error_num */, char * /* file */, int /* line */ )
+{
+}
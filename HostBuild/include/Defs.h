@@ -0,0 +1,63 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file Defs.h
+///
+/// Linux host stand in for the product's Defs.h, only the types and definitions the diagnostics built on the host
+/// use.  The integer types keep the sizes they have on Blackfin.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(DEFS_H)
+#define DEFS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t            UINT8;
+typedef uint16_t           UINT16;
+typedef uint32_t           UINT32;
+typedef uint64_t           UINT64;
+typedef int8_t             INT8;
+typedef int16_t            INT16;
+typedef int32_t            INT32;
+typedef int64_t            INT64;
+typedef int32_t            INT;
+typedef uint32_t           UINT;
+typedef int32_t            BOOL;
+typedef uint8_t            USINT;
+typedef int8_t             SINT;
+typedef uint32_t           UDINT;
+typedef int32_t            DINT;
+typedef uint64_t           ULINT;
+typedef int64_t            LINT;
+
+#define TRUE               1
+#define FALSE              0
+
+#define OK                 0
+#define ERROR              (-1)
+
+#define INLINE             inline
+
+// User data _OS_Assert copies into the crash header.
+typedef struct
+{
+    UDINT param1;
+    UDINT param2;
+    UDINT param3;
+}
+USER_CRASH_DATA;
+
+// VisualDSP++ run time library heaps Os_iotk.h allocates from.  Never called by the diagnostics, so not defined.
+extern "C" void * heap_malloc( int heapIndex, size_t length );
+extern "C" void   heap_free( int heapIndex, void * ptr );
+extern "C" void * heap_calloc( int heapIndex, size_t nelem, size_t elsize );
+extern "C" void * heap_realloc( int heapIndex, void * ptr, size_t length );
+
+#endif // !defined(DEFS_H)
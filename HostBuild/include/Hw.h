@@ -0,0 +1,32 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file Hw.h
+///
+/// Linux host stand in for the product's Hw.h.  _GET_CYCLE_COUNT reads the time stamp counter on x86 hosts, so the
+/// benchmarks report cycles of the host, and reads 0 elsewhere.  There are no Blackfin memory mapped registers, the
+/// diagnostics built on the host do not touch them with BLACKFIN_DIAG_HOST_BUILD defined.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(HW_H)
+#define HW_H
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#define _GET_CYCLE_COUNT( x )      ( ( x ) = __rdtsc() )
+#else
+#define _GET_CYCLE_COUNT( x )      ( ( x ) = 0 )
+#endif
+
+// Interrupt levels Os_iotk.h builds its interrupt mask from.
+#define EVT_IVG9                   0x00000200
+#define EVT_IVG12                  0x00001000
+#define EVT_IVG14                  0x00004000
+
+#endif // !defined(HW_H)
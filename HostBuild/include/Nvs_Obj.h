@@ -0,0 +1,18 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file Nvs_Obj.h
+///
+/// Linux host stand in for the product's Nvs_Obj.h.  Nothing in it is used by the diagnostics built on the host.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(NVS_OBJ_H)
+#define NVS_OBJ_H
+
+#endif // !defined(NVS_OBJ_H)
@@ -0,0 +1,36 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file ccblkfn.h
+///
+/// Linux host stand in for the VisualDSP++ Blackfin built-in functions.  The host has no interrupts to disable and
+/// no pipelines to synchronise, so they do nothing.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(CCBLKFN_H)
+#define CCBLKFN_H
+
+inline unsigned int cli()
+{
+    return 0;
+}
+
+inline void sti( unsigned int )
+{
+}
+
+inline void ssync()
+{
+}
+
+inline void csync()
+{
+}
+
+#endif // !defined(CCBLKFN_H)
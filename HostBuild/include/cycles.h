@@ -0,0 +1,25 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file cycles.h
+///
+/// Linux host stand in for the VisualDSP++ cycle counting header Os_iotk.h includes.  DO_CYCLE_COUNTS is never
+/// defined on the host, only the type is needed.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(CYCLES_H)
+#define CYCLES_H
+
+typedef struct
+{
+    unsigned long long _cycles;
+}
+cycle_stats_t;
+
+#endif // !defined(CYCLES_H)
@@ -0,0 +1,21 @@
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @file exception.h
+///
+/// Linux host stand in for the VisualDSP++ interrupt handler header Os_iotk.h includes.  Handlers are plain
+/// functions on the host.
+///
+/// @if REVISION_HISTORY_INCLUDED
+/// @par Edit History
+/// - [0]  agent    19-Oct-2026 Initial revision of file.
+/// @endif
+///
+/// @ingroup Diagnostics
+///
+/// @par Copyright (c) 2026 Rockwell Automation Technologies, Inc.  All rights reserved.
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#if !defined(EXCEPTION_H)
+#define EXCEPTION_H
+
+#define EX_INTERRUPT_HANDLER( func )    void func( void )
+
+#endif // !defined(EXCEPTION_H)
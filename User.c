@@ -84,6 +84,8 @@
 #include "Bld_Block.h"
 
 extern "C" void RunDiagnostics();
+extern "C" void PauseMemoryDiagnostics();
+extern "C" void ResumeMemoryDiagnostics();
 
 /*---------------------------------------------------------------------------
 **
@@ -284,6 +286,9 @@ void User_NullProcess( void )
       /* Check if we need to store off the new InputRange/NotchFilter settings */
       if ( new_flash_pending )
       {
+         /* Hold off the memory diagnostics while the flash is busy */
+         PauseMemoryDiagnostics( );
+
          if ( ! waiting_on_erase )
          {
             /* Now erase Cal data (configuration segment) and burn the new values. */
@@ -302,6 +307,9 @@ void User_NullProcess( void )
                OS_Assert( OS_ASSERT_HW_ERR );
             }
             new_flash_pending = FALSE;
+
+            /* Flash is done so let the memory diagnostics continue */
+            ResumeMemoryDiagnostics( );
          }
       }
       else